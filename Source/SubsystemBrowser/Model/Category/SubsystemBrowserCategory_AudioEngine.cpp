@@ -36,7 +36,7 @@ void FSubsystemCategory_AudioEngine::Select(UWorld* InContext, TArray<UObject*>&
 
 void FSubsystemCategory_AudioEngine::SelectSettings(TArray<UObject*>& OutData) const
 {
-	::GetObjectsOfClass(UAudioEngineSubsystem::StaticClass(), OutData, true, EObjectFlags::RF_NoFlags);
+	SelectDefaultObjects(UAudioEngineSubsystem::StaticClass(), OutData);
 }
 
 #endif
@@ -29,5 +29,5 @@ void FSubsystemCategory_Editor::Select(UWorld* InContext, TArray<UObject*>& OutD
 
 void FSubsystemCategory_Editor::SelectSettings(TArray<UObject*>& OutData) const
 {
-	::GetObjectsOfClass(UEditorSubsystem::StaticClass(), OutData, true, EObjectFlags::RF_NoFlags);
+	SelectDefaultObjects(UEditorSubsystem::StaticClass(), OutData);
 }
@@ -29,5 +29,5 @@ void FSubsystemCategory_Engine::Select(UWorld* InContext, TArray<UObject*>& OutD
 
 void FSubsystemCategory_Engine::SelectSettings(TArray<UObject*>& OutData) const
 {
-	::GetObjectsOfClass(UEngineSubsystem::StaticClass(), OutData, true, EObjectFlags::RF_NoFlags);
+	SelectDefaultObjects(UEngineSubsystem::StaticClass(), OutData);
 }
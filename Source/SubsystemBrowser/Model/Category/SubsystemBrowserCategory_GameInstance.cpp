@@ -31,7 +31,7 @@ void FSubsystemCategory_GameInstance::Select(UWorld* InContext, TArray<UObject*>
 
 void FSubsystemCategory_GameInstance::SelectSettings(TArray<UObject*>& OutData) const
 {
-	::GetObjectsOfClass(UGameInstanceSubsystem::StaticClass(), OutData, true, EObjectFlags::RF_NoFlags);
+	SelectDefaultObjects(UGameInstanceSubsystem::StaticClass(), OutData);
 }
 
 void FSubsystemCategory_GameInstance::GenerateTooltip(UWorld* InContext, class FSubsystemTableItemTooltipBuilder& TooltipBuilder) const
@@ -34,5 +34,5 @@ void FSubsystemCategory_Player::Select(UWorld* InContext, TArray<UObject*>& OutD
 
 void FSubsystemCategory_Player::SelectSettings(TArray<UObject*>& OutData) const
 {
-	::GetObjectsOfClass(ULocalPlayerSubsystem::StaticClass(), OutData, true, EObjectFlags::RF_NoFlags);
+	SelectDefaultObjects(ULocalPlayerSubsystem::StaticClass(), OutData);
 }
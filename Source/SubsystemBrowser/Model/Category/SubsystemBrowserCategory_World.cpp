@@ -30,7 +30,7 @@ void FSubsystemCategory_World::Select(UWorld* InContext, TArray<UObject*>& OutDa
 
 void FSubsystemCategory_World::SelectSettings(TArray<UObject*>& OutData) const
 {
-	::GetObjectsOfClass(UWorldSubsystem::StaticClass(), OutData, true, EObjectFlags::RF_NoFlags);
+	SelectDefaultObjects(UWorldSubsystem::StaticClass(), OutData);
 }
 
 void FSubsystemCategory_World::GenerateTooltip(UWorld* InContext, class FSubsystemTableItemTooltipBuilder& TooltipBuilder) const
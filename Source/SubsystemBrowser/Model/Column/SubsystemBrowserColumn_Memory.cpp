@@ -0,0 +1,71 @@
+﻿// Copyright 2022, Aquanox.
+
+#include "Model/Column/SubsystemBrowserColumn_Memory.h"
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserSorting.h"
+#include "Model/SubsystemBrowserMemoryStats.h"
+
+#define LOCTEXT_NAMESPACE "SubsystemBrowser"
+
+FSubsystemDynamicColumn_Memory::FSubsystemDynamicColumn_Memory(bool bInInclusive)
+	: bInclusive(bInInclusive)
+{
+	if (bInclusive)
+	{
+		Name = TEXT("MemoryInclusive");
+		TableLabel = LOCTEXT("SubsystemBrowser_Column_MemoryInclusive", "Memory");
+		ConfigLabel = LOCTEXT("SubsystemBrowser_Column_MemoryInclusive_Config", "Memory (Inclusive)");
+	}
+	else
+	{
+		Name = TEXT("MemoryExclusive");
+		TableLabel = LOCTEXT("SubsystemBrowser_Column_MemoryExclusive", "Self Memory");
+		ConfigLabel = LOCTEXT("SubsystemBrowser_Column_MemoryExclusive_Config", "Memory (Exclusive)");
+	}
+	PreferredWidthRatio = 0.1f;
+}
+
+FText FSubsystemDynamicColumn_Memory::ExtractText(TSharedRef<const ISubsystemTreeItem> Item) const
+{
+	if (!Item->GetObjectForDetails())
+	{
+		return FText::GetEmpty();
+	}
+
+	const int64 Size = GetSize(*Item);
+	return Size >= 0 ? FText::AsMemory(Size) : LOCTEXT("MemoryPending", "...");
+}
+
+FText FSubsystemDynamicColumn_Memory::ExtractTooltipText(TSharedRef<const ISubsystemTreeItem> Item) const
+{
+	const FSubsystemMemoryInfo* Info = FSubsystemBrowserModule::Get().GetMemoryStats().Find(Item->GetObjectForDetails());
+	if (!Info)
+	{
+		return FText::GetEmpty();
+	}
+
+	return FText::Format(LOCTEXT("MemoryTooltip", "Exclusive: {0}\nInclusive: {1}\nOwned objects: {2}"),
+		FText::AsMemory(Info->ExclusiveBytes), FText::AsMemory(Info->InclusiveBytes), FText::AsNumber(Info->NumInners));
+}
+
+void FSubsystemDynamicColumn_Memory::SortItems(TArray<SubsystemTreeItemPtr>& RootItems, const EColumnSortMode::Type SortMode) const
+{
+	// rows still being measured go last regardless of direction
+	SubsystemBrowser::FSortHelper<SubsystemTreeItemPtr, bool, int64>()
+		.Primary([this](TSharedPtr<ISubsystemTreeItem> Item) { return GetSize(*Item) < 0; }, EColumnSortMode::Ascending)
+		.Secondary([this](TSharedPtr<ISubsystemTreeItem> Item) { return GetSize(*Item); }, SortMode)
+		.Sort(RootItems);
+}
+
+int64 FSubsystemDynamicColumn_Memory::GetSize(const ISubsystemTreeItem& Item) const
+{
+	const FSubsystemMemoryInfo* Info = FSubsystemBrowserModule::Get().GetMemoryStats().Find(Item.GetObjectForDetails());
+	if (!Info)
+	{
+		return -1;
+	}
+	return (int64)(bInclusive ? Info->InclusiveBytes : Info->ExclusiveBytes);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,28 @@
+﻿// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "Model/SubsystemBrowserColumn.h"
+
+/**
+ * "Memory" column implementation.
+ * Displays inclusive or exclusive memory footprint of object, measured in background.
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemDynamicColumn_Memory : public FSubsystemDynamicTextColumn
+{
+	using Super = FSubsystemDynamicTextColumn;
+
+	explicit FSubsystemDynamicColumn_Memory(bool bInInclusive);
+
+	virtual bool IsVisibleByDefault() const override { return false; }
+
+	virtual FText ExtractText(TSharedRef<const ISubsystemTreeItem> Item) const override;
+	virtual FText ExtractTooltipText(TSharedRef<const ISubsystemTreeItem> Item) const override;
+	virtual void SortItems(TArray<SubsystemTreeItemPtr>& RootItems, const EColumnSortMode::Type SortMode) const override;
+
+protected:
+	/* measured size of item or -1 while it is pending */
+	int64 GetSize(const ISubsystemTreeItem& Item) const;
+
+	bool bInclusive = true;
+};
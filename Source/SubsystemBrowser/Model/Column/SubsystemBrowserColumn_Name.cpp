@@ -97,7 +97,8 @@ FText FSubsystemDynamicColumn_Name::ExtractText(TSharedRef<const ISubsystemTreeI
 FSlateColor FSubsystemDynamicColumn_Name::ExtractColor(TSharedRef<const ISubsystemTreeItem> Item) const
 {
 	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
-	if (Settings->IsColoringEnabled() && !Item->IsStale() && !Item->IsSelected())
+	const bool bRecentlyChanged = Settings->ShouldDetectChanges() && Item->WasChangedRecently(Settings->GetChangeHighlightDuration());
+	if (Settings->IsColoringEnabled() && !Item->IsStale() && !Item->IsSelected() && !bRecentlyChanged)
 	{
 		if (const FSubsystemTreeSubsystemItem* SubsystemItem = Item->GetAsSubsystemDescriptor())
 		{
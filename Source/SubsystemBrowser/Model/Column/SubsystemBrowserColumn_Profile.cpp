@@ -0,0 +1,97 @@
+﻿// Copyright 2022, Aquanox.
+
+#include "Model/Column/SubsystemBrowserColumn_Profile.h"
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserSorting.h"
+#include "Model/SubsystemBrowserDescriptor.h"
+#include "Model/SubsystemBrowserProfileImport.h"
+#include "Misc/Paths.h"
+
+#define LOCTEXT_NAMESPACE "SubsystemBrowser"
+
+FSubsystemDynamicColumn_Profile::FSubsystemDynamicColumn_Profile(bool bInCalls)
+	: bCalls(bInCalls)
+{
+	if (bCalls)
+	{
+		Name = TEXT("ProfiledCalls");
+		TableLabel = LOCTEXT("SubsystemBrowser_Column_ProfiledCalls", "Calls");
+		ConfigLabel = LOCTEXT("SubsystemBrowser_Column_ProfiledCalls_Config", "Profiled Calls");
+	}
+	else
+	{
+		Name = TEXT("ProfiledMs");
+		TableLabel = LOCTEXT("SubsystemBrowser_Column_ProfiledMs", "Profiled ms");
+		ConfigLabel = LOCTEXT("SubsystemBrowser_Column_ProfiledMs_Config", "Profiled ms");
+	}
+	PreferredWidthRatio = 0.1f;
+}
+
+FText FSubsystemDynamicColumn_Profile::ExtractText(TSharedRef<const ISubsystemTreeItem> Item) const
+{
+	const FSubsystemProfileTiming* Timing = FindTiming(*Item);
+	if (!Timing)
+	{
+		return FText::GetEmpty();
+	}
+
+	if (bCalls)
+	{
+		// frames with time are not calls, they are listed in tooltip only
+		return FSubsystemBrowserModule::Get().GetProfileImport().HasCallCounts() ? FText::AsNumber(Timing->Calls) : FText::GetEmpty();
+	}
+
+	FNumberFormattingOptions Options;
+	Options.MinimumFractionalDigits = 2;
+	Options.MaximumFractionalDigits = 2;
+	return FText::AsNumber(Timing->TotalMs, &Options);
+}
+
+FText FSubsystemDynamicColumn_Profile::ExtractTooltipText(TSharedRef<const ISubsystemTreeItem> Item) const
+{
+	const FSubsystemProfileTiming* Timing = FindTiming(*Item);
+	if (!Timing)
+	{
+		return FText::GetEmpty();
+	}
+
+	const FSubsystemProfileImport& ProfileImport = FSubsystemBrowserModule::Get().GetProfileImport();
+	const FText Format = ProfileImport.HasCallCounts()
+		? LOCTEXT("ProfiledTooltip", "Total: {0} ms\nCalls: {1}\nAverage: {2} ms\nSource: {3}")
+		: LOCTEXT("ProfiledTooltip_Frames", "Total: {0} ms\nFrames with time: {1}\nAverage per frame: {2} ms\nSource: {3}");
+	return FText::Format(Format,
+		FText::AsNumber(Timing->TotalMs), FText::AsNumber(Timing->Calls),
+		FText::AsNumber(Timing->Calls > 0 ? Timing->TotalMs / Timing->Calls : 0.0),
+		FText::FromString(FPaths::GetCleanFilename(ProfileImport.GetFilePath())));
+}
+
+void FSubsystemDynamicColumn_Profile::SortItems(TArray<SubsystemTreeItemPtr>& RootItems, const EColumnSortMode::Type SortMode) const
+{
+	SubsystemBrowser::FSortHelper<SubsystemTreeItemPtr, double>()
+		.Primary([this](TSharedPtr<ISubsystemTreeItem> Item) { return GetValue(*Item); }, SortMode)
+		.Sort(RootItems);
+}
+
+const FSubsystemProfileTiming* FSubsystemDynamicColumn_Profile::FindTiming(const ISubsystemTreeItem& Item) const
+{
+	const FSubsystemTreeSubsystemItem* Subsystem = Item.GetAsSubsystemDescriptor();
+	const FSubsystemProfileImport& ProfileImport = FSubsystemBrowserModule::Get().GetProfileImport();
+	return Subsystem && ProfileImport.HasResults() ? ProfileImport.Find(Subsystem->ClassName) : nullptr;
+}
+
+double FSubsystemDynamicColumn_Profile::GetValue(const ISubsystemTreeItem& Item) const
+{
+	const FSubsystemProfileTiming* Timing = FindTiming(Item);
+	if (!Timing)
+	{
+		return -1.0;
+	}
+	if (bCalls)
+	{
+		return FSubsystemBrowserModule::Get().GetProfileImport().HasCallCounts() ? (double)Timing->Calls : -1.0;
+	}
+	return Timing->TotalMs;
+}
+
+#undef LOCTEXT_NAMESPACE
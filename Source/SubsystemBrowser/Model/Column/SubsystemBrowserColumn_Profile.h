@@ -0,0 +1,30 @@
+﻿// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "Model/SubsystemBrowserColumn.h"
+
+/**
+ * "Profiled" column implementation.
+ * Displays total time or number of calls of subsystem scopes found in imported profile.
+ * Calls stay empty for captures that record frames instead of calls.
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemDynamicColumn_Profile : public FSubsystemDynamicTextColumn
+{
+	using Super = FSubsystemDynamicTextColumn;
+
+	explicit FSubsystemDynamicColumn_Profile(bool bInCalls);
+
+	virtual bool IsVisibleByDefault() const override { return false; }
+
+	virtual FText ExtractText(TSharedRef<const ISubsystemTreeItem> Item) const override;
+	virtual FText ExtractTooltipText(TSharedRef<const ISubsystemTreeItem> Item) const override;
+	virtual void SortItems(TArray<SubsystemTreeItemPtr>& RootItems, const EColumnSortMode::Type SortMode) const override;
+
+protected:
+	const struct FSubsystemProfileTiming* FindTiming(const ISubsystemTreeItem& Item) const;
+	/* displayed value of item or -1 when it was not found in profile */
+	double GetValue(const ISubsystemTreeItem& Item) const;
+
+	bool bCalls = false;
+};
@@ -0,0 +1,102 @@
+﻿// Copyright 2022, Aquanox.
+
+#include "Model/Column/SubsystemBrowserColumn_TickCost.h"
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserSorting.h"
+#include "Model/SubsystemBrowserTickStats.h"
+
+#define LOCTEXT_NAMESPACE "SubsystemBrowser"
+
+namespace SubsystemTickCostColumn
+{
+	static FText FormatMs(float InValue)
+	{
+		FNumberFormattingOptions Options;
+		Options.MinimumFractionalDigits = 2;
+		Options.MaximumFractionalDigits = 3;
+		return FText::AsNumber(InValue, &Options);
+	}
+}
+
+FSubsystemDynamicColumn_TickCost::FSubsystemDynamicColumn_TickCost()
+{
+	Name = TEXT("TickCost");
+	TableLabel = LOCTEXT("SubsystemBrowser_Column_TickCost", "Tick");
+	ConfigLabel = LOCTEXT("SubsystemBrowser_Column_TickCost_Config", "Tick Cost");
+	PreferredWidthRatio = 0.1f;
+}
+
+FText FSubsystemDynamicColumn_TickCost::ExtractText(TSharedRef<const ISubsystemTreeItem> Item) const
+{
+	const TOptional<FSubsystemTickInfo> Info = FSubsystemBrowserModule::Get().GetTickStats().Find(Item->GetObjectForDetails());
+	if (!Info.IsSet())
+	{
+		return FText::GetEmpty();
+	}
+
+	if (Info->NumSharingInstances > 1)
+	{
+		return FText::Format(LOCTEXT("TickCostText_Shared", "{0} / {1} ms (x{2})"),
+			SubsystemTickCostColumn::FormatMs(Info->AverageMs), SubsystemTickCostColumn::FormatMs(Info->MaxMs), FText::AsNumber(Info->NumSharingInstances));
+	}
+
+	return FText::Format(LOCTEXT("TickCostText", "{0} / {1} ms"),
+		SubsystemTickCostColumn::FormatMs(Info->AverageMs), SubsystemTickCostColumn::FormatMs(Info->MaxMs));
+}
+
+FText FSubsystemDynamicColumn_TickCost::ExtractTooltipText(TSharedRef<const ISubsystemTreeItem> Item) const
+{
+	const TOptional<FSubsystemTickInfo> Info = FSubsystemBrowserModule::Get().GetTickStats().Find(Item->GetObjectForDetails());
+	if (!Info.IsSet())
+	{
+		return LOCTEXT("TickCostTooltip_None", "No tick recorded in recent frames");
+	}
+
+	FText Result = FText::Format(LOCTEXT("TickCostTooltip", "Average: {0} ms\nMax: {1} ms\nLast: {2} ms\nFrames: {3}"),
+		SubsystemTickCostColumn::FormatMs(Info->AverageMs), SubsystemTickCostColumn::FormatMs(Info->MaxMs),
+		SubsystemTickCostColumn::FormatMs(Info->LastMs), FText::AsNumber(Info->NumFrames));
+
+	if (Info->NumSharingInstances > 1)
+	{
+		Result = FText::Format(LOCTEXT("TickCostTooltip_Shared", "{0}\n\nStat is shared by {1} ticking instances in all worlds, values are their sum"),
+			Result, FText::AsNumber(Info->NumSharingInstances));
+	}
+	return Result;
+}
+
+void FSubsystemDynamicColumn_TickCost::OnDisplayStateChanged(bool bDisplayed)
+{
+	// panels may outlive module on editor exit
+	FSubsystemBrowserModule* Module = FModuleManager::GetModulePtr<FSubsystemBrowserModule>(TEXT("SubsystemBrowser"));
+	if (!Module)
+	{
+		return;
+	}
+
+	if (bDisplayed)
+	{
+		Module->GetTickStats().AddRequest();
+	}
+	else
+	{
+		Module->GetTickStats().RemoveRequest();
+	}
+}
+
+void FSubsystemDynamicColumn_TickCost::SortItems(TArray<SubsystemTreeItemPtr>& RootItems, const EColumnSortMode::Type SortMode) const
+{
+	// rows without recorded ticks go last regardless of direction
+	SubsystemBrowser::FSortHelper<SubsystemTreeItemPtr, bool, float>()
+		.Primary([this](TSharedPtr<ISubsystemTreeItem> Item) { return GetAverageMs(*Item) < 0.f; }, EColumnSortMode::Ascending)
+		.Secondary([this](TSharedPtr<ISubsystemTreeItem> Item) { return GetAverageMs(*Item); }, SortMode)
+		.Sort(RootItems);
+}
+
+float FSubsystemDynamicColumn_TickCost::GetAverageMs(const ISubsystemTreeItem& Item) const
+{
+	const TOptional<FSubsystemTickInfo> Info = FSubsystemBrowserModule::Get().GetTickStats().Find(Item.GetObjectForDetails());
+	return Info.IsSet() ? Info->AverageMs : -1.f;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,27 @@
+﻿// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "Model/SubsystemBrowserColumn.h"
+
+/**
+ * "Tick" column implementation.
+ * Displays average and maximum tick time of tickable subsystems over recent frames.
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemDynamicColumn_TickCost : public FSubsystemDynamicTextColumn
+{
+	using Super = FSubsystemDynamicTextColumn;
+
+	FSubsystemDynamicColumn_TickCost();
+
+	virtual bool IsVisibleByDefault() const override { return false; }
+	virtual void OnDisplayStateChanged(bool bDisplayed) override;
+
+	virtual FText ExtractText(TSharedRef<const ISubsystemTreeItem> Item) const override;
+	virtual FText ExtractTooltipText(TSharedRef<const ISubsystemTreeItem> Item) const override;
+	virtual void SortItems(TArray<SubsystemTreeItemPtr>& RootItems, const EColumnSortMode::Type SortMode) const override;
+
+protected:
+	/* average tick time of item or -1 when it is not known to tick */
+	float GetAverageMs(const ISubsystemTreeItem& Item) const;
+};
@@ -0,0 +1,53 @@
+﻿// Copyright 2022, Aquanox.
+
+#include "Model/Column/SubsystemBrowserColumn_Watch.h"
+
+#include "SubsystemBrowserModule.h"
+#include "Model/SubsystemBrowserPropertyWatch.h"
+#include "UI/SubsystemSparkline.h"
+#include "UI/SubsystemTableItem.h"
+#include "Widgets/Layout/SBox.h"
+
+#define LOCTEXT_NAMESPACE "SubsystemBrowser"
+
+FSubsystemDynamicColumn_Watch::FSubsystemDynamicColumn_Watch()
+{
+	Name = TEXT("Watch");
+	TableLabel = LOCTEXT("SubsystemBrowser_Column_Watch", "Watch");
+	ConfigLabel = LOCTEXT("SubsystemBrowser_Column_Watch", "Watch");
+	PreferredWidthRatio = 0.15f;
+}
+
+TSharedPtr<SWidget> FSubsystemDynamicColumn_Watch::GenerateColumnWidget(TSharedRef<const ISubsystemTreeItem> Item, TSharedRef<SSubsystemTableItem> TableRow) const
+{
+	return SNew(SBox)
+		.Padding(FMargin(2, 1))
+		.ToolTipText(this, &FSubsystemDynamicColumn_Watch::ExtractTooltipText, Item)
+		[
+			SNew(SSubsystemSparkline, FSubsystemBrowserModule::Get().GetPropertyWatcher())
+			.Object(Item->GetObjectForDetails())
+		];
+}
+
+FText FSubsystemDynamicColumn_Watch::ExtractTooltipText(TSharedRef<const ISubsystemTreeItem> Item) const
+{
+	const UObject* Object = Item->GetObjectForDetails();
+	if (!Object)
+	{
+		return FText::GetEmpty();
+	}
+
+	FString Result;
+	FSubsystemBrowserModule::Get().GetPropertyWatcher().ForEachWatch(Object, [&Result](const FSubsystemPropertyWatch& Watch)
+	{
+		if (Result.Len())
+		{
+			Result += TEXT("\n");
+		}
+		Result += FString::Printf(TEXT("%s = %g"), *Watch.Path, Watch.History.GetLatest());
+	});
+
+	return FText::FromString(Result);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,24 @@
+﻿// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "Model/SubsystemBrowserColumn.h"
+
+/**
+ * "Watch" column implementation.
+ * Draws history of properties watched via details view as sparklines.
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemDynamicColumn_Watch : public FSubsystemDynamicColumn
+{
+	using Super = FSubsystemDynamicColumn;
+
+	FSubsystemDynamicColumn_Watch();
+
+	virtual bool IsVisibleByDefault() const override { return false; }
+
+	virtual TSharedPtr<SWidget> GenerateColumnWidget(TSharedRef<const ISubsystemTreeItem> Item, TSharedRef<class SSubsystemTableItem> TableRow) const override;
+
+protected:
+	/* list watched properties with their latest values */
+	FText ExtractTooltipText(TSharedRef<const ISubsystemTreeItem> Item) const;
+};
@@ -4,6 +4,7 @@
 
 #include "SubsystemBrowserFlags.h"
 #include "Subsystems/Subsystem.h"
+#include "UObject/UObjectHash.h"
 
 #define LOCTEXT_NAMESPACE "SubsystemBrowser"
 
@@ -12,6 +13,22 @@ FSubsystemCategory::FSubsystemCategory(const FName& Name, const FText& Label, in
 {
 }
 
+void FSubsystemCategory::SelectDefaultObjects(const UClass* InBaseClass, TArray<UObject*>& OutData)
+{
+	TArray<UClass*> Classes;
+	Classes.Add(const_cast<UClass*>(InBaseClass));
+	::GetDerivedClasses(InBaseClass, Classes, true);
+
+	OutData.Reserve(OutData.Num() + Classes.Num());
+	for (UClass* Class : Classes)
+	{
+		if (UObject* DefaultObject = Class->GetDefaultObject(false))
+		{
+			OutData.Add(DefaultObject);
+		}
+	}
+}
+
 void FSimpleSubsystemCategory::Select(UWorld* InContext, TArray<UObject*>& OutData) const
 {
 	Selector.ExecuteIfBound(InContext, OutData);
@@ -43,6 +43,14 @@ struct SUBSYSTEMBROWSER_API FSubsystemCategory : public TSharedFromThis<FSubsyst
 
 	/* generate custom tooltips for category item */
 	virtual void GenerateTooltip(UWorld* InContext, class FSubsystemTableItemTooltipBuilder& TooltipBuilder) const {}
+
+	/*
+	 * Select class default objects of base class and all classes derived from it.
+	 *
+	 * Uses class hierarchy index instead of object iteration, so the cost depends on number of classes
+	 * rather than number of live instances. Default objects that were not created yet are skipped.
+	 */
+	static void SelectDefaultObjects(const UClass* InBaseClass, TArray<UObject*>& OutData);
 };
 
 using SubsystemCategoryPtr = TSharedPtr<FSubsystemCategory>;
@@ -0,0 +1,165 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserChangeSampler.h"
+
+#include "SubsystemBrowserTrace.h"
+#include "Model/SubsystemBrowserDescriptor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/UnrealType.h"
+
+void FSubsystemChangeSampler::SetItems(const TArray<TSharedPtr<ISubsystemTreeItem>>& InItems)
+{
+	TMap<const ISubsystemTreeItem*, FEntry> PreviousEntries;
+	PreviousEntries.Reserve(Entries.Num());
+	for (const FEntry& Entry : Entries)
+	{
+		if (TSharedPtr<ISubsystemTreeItem> Item = Entry.Item.Pin())
+		{
+			PreviousEntries.Add(Item.Get(), Entry);
+		}
+	}
+
+	Entries.Reset(InItems.Num());
+	for (const TSharedPtr<ISubsystemTreeItem>& Item : InItems)
+	{
+		if (!Item.IsValid())
+			continue;
+
+		if (const FEntry* Previous = PreviousEntries.Find(Item.Get()))
+		{
+			Entries.Add(*Previous);
+		}
+		else
+		{
+			FEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.Item = Item;
+		}
+	}
+
+	// restart pass so new items get their baseline quickly
+	Cursor = 0;
+	FramesToNextPass = 0;
+}
+
+void FSubsystemChangeSampler::Reset()
+{
+	Entries.Empty();
+	Cursor = 0;
+	FramesToNextPass = 0;
+}
+
+void FSubsystemChangeSampler::Tick(uint32 InFrameInterval, double InBudgetSeconds, TArray<TSharedPtr<ISubsystemTreeItem>>& OutChanged)
+{
+	if (!IsPassInProgress())
+	{
+		if (FramesToNextPass > 0)
+		{
+			--FramesToNextPass;
+			return;
+		}
+
+		if (!Entries.Num())
+		{
+			return;
+		}
+
+		Cursor = 0;
+	}
+
+	SB_TRACE_SCOPE(FSubsystemChangeSampler::Tick);
+
+	const double StartTime = FPlatformTime::Seconds();
+	do
+	{
+		FEntry& Entry = Entries[Cursor++];
+
+		TSharedPtr<ISubsystemTreeItem> Item = Entry.Item.Pin();
+		const UObject* Object = Item.IsValid() ? Item->GetObjectForDetails() : nullptr;
+		if (!IsValid(Object))
+			continue;
+
+		const uint32 Hash = HashObjectState(Object);
+		if (Entry.bHasHash && Entry.Hash != Hash)
+		{
+			OutChanged.Add(Item);
+		}
+
+		Entry.Hash = Hash;
+		Entry.bHasHash = true;
+	}
+	while (IsPassInProgress() && FPlatformTime::Seconds() - StartTime < InBudgetSeconds);
+
+	if (!IsPassInProgress())
+	{
+		FramesToNextPass = InFrameInterval;
+	}
+}
+
+uint32 FSubsystemChangeSampler::HashObjectState(const UObject* InObject)
+{
+	uint32 Hash = 0;
+
+	// reused between properties to avoid reallocations
+	FString ExportValue;
+
+	for (TFieldIterator<FProperty> It(InObject->GetClass()); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (Property->HasAnyPropertyFlags(CPF_Deprecated))
+			continue;
+
+		const uint8* ValuePtr = Property->ContainerPtrToValuePtr<uint8>(InObject);
+
+		// static arrays of plain data are hashed in one go
+		if (Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
+		{
+			Hash = FCrc::MemCrc32(ValuePtr, Property->GetSize(), Hash);
+			continue;
+		}
+
+		for (int32 Idx = 0; Idx < Property->ArrayDim; Idx++)
+		{
+			Hash = HashPropertyValue(Property, ValuePtr + Idx * Property->ElementSize, InObject, ExportValue, Hash);
+		}
+	}
+
+	return Hash;
+}
+
+uint32 FSubsystemChangeSampler::HashPropertyValue(const FProperty* InProperty, const uint8* InValuePtr, const UObject* InOwner, FString& InScratch, uint32 InCrc)
+{
+	if (InProperty->HasAnyPropertyFlags(CPF_IsPlainOldData))
+	{
+		return FCrc::MemCrc32(InValuePtr, InProperty->ElementSize, InCrc);
+	}
+
+	const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty);
+	if (ArrayProperty && ArrayProperty->Inner->HasAnyPropertyFlags(CPF_IsPlainOldData))
+	{
+		FScriptArrayHelper Helper(ArrayProperty, InValuePtr);
+		const int32 Num = Helper.Num();
+		uint32 Hash = HashCombine(InCrc, GetTypeHash(Num));
+		if (Num > 0)
+		{
+			Hash = FCrc::MemCrc32(Helper.GetRawPtr(0), Num * ArrayProperty->Inner->ElementSize, Hash);
+		}
+		return Hash;
+	}
+
+	// type hashes of strings and names are case-insensitive, only use them where value hash is exact
+	const bool bExactTypeHash = InProperty->IsA<FNumericProperty>() || InProperty->IsA<FEnumProperty>() || InProperty->IsA<FBoolProperty>();
+	if (bExactTypeHash && InProperty->HasAnyPropertyFlags(CPF_HasGetValueTypeHash))
+	{
+		return HashCombine(InCrc, InProperty->GetValueTypeHash(InValuePtr));
+	}
+
+	InScratch.Reset();
+#if UE_VERSION_OLDER_THAN(5,1,0)
+	InProperty->ExportTextItem(InScratch, InValuePtr, nullptr, const_cast<UObject*>(InOwner), PPF_None);
+#else
+	InProperty->ExportTextItem_Direct(InScratch, InValuePtr, nullptr, const_cast<UObject*>(InOwner), PPF_None);
+#endif
+	return FCrc::StrCrc32(*InScratch, InCrc);
+}
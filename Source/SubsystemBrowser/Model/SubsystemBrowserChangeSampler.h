@@ -0,0 +1,56 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct ISubsystemTreeItem;
+class FProperty;
+
+/**
+ * Time-sliced detector of changes in reflected state of displayed subsystems.
+ *
+ * Every pass hashes each registered item once, spreading work over several frames within a time budget.
+ * Passes are separated by a configured number of idle frames. Item is reported as changed when its hash
+ * differs from the one recorded by previous pass; first hash of an item only establishes a baseline.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemChangeSampler
+{
+public:
+	/* replace set of sampled items, recorded hashes of items that are still present are kept */
+	void SetItems(const TArray<TSharedPtr<ISubsystemTreeItem>>& InItems);
+	/* forget all items and recorded hashes */
+	void Reset();
+
+	/**
+	 * Advance sampling by one frame.
+	 * At least one item is hashed on active frame so pass always completes regardless of budget.
+	 *
+	 * @param InFrameInterval number of idle frames between two passes
+	 * @param InBudgetSeconds maximum time to spend hashing during this frame
+	 * @param OutChanged items which state changed since previous pass
+	 */
+	void Tick(uint32 InFrameInterval, double InBudgetSeconds, TArray<TSharedPtr<ISubsystemTreeItem>>& OutChanged);
+
+	int32 GetNumItems() const { return Entries.Num(); }
+	bool IsPassInProgress() const { return Cursor < Entries.Num(); }
+
+	/* hash reflected properties of object. plain data is hashed as memory, other values by type hash or exported text */
+	static uint32 HashObjectState(const UObject* InObject);
+	/* hash single element of property value, scratch string is used for values hashed by exported text */
+	static uint32 HashPropertyValue(const FProperty* InProperty, const uint8* InValuePtr, const UObject* InOwner, FString& InScratch, uint32 InCrc = 0);
+
+private:
+	struct FEntry
+	{
+		TWeakPtr<ISubsystemTreeItem> Item;
+		uint32 Hash = 0;
+		bool bHasHash = false;
+	};
+
+	TArray<FEntry> Entries;
+	/* next entry to hash within current pass, equals to number of entries when idle */
+	int32 Cursor = 0;
+	/* idle frames remaining before next pass */
+	uint32 FramesToNextPass = 0;
+};
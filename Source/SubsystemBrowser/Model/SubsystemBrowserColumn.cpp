@@ -77,6 +77,10 @@ FSlateColor FSubsystemDynamicTextColumn::ExtractColor(TSharedRef<const ISubsyste
 	{
 		return Settings->GetSelectedColor();
 	}
+	if (Settings->ShouldDetectChanges() && Item->WasChangedRecently(Settings->GetChangeHighlightDuration()))
+	{
+		return Settings->GetChangedColor();
+	}
 	return FSlateColor::UseForeground();
 }
 
@@ -59,6 +59,12 @@ struct SUBSYSTEMBROWSER_API FSubsystemDynamicColumn : public TSharedFromThis<FSu
 	 * Get default column visibility state
 	 */
 	virtual bool IsVisibleByDefault() const { return false; }
+
+	/**
+	 * Notify column that a browser panel started or stopped displaying it, calls are balanced per panel.
+	 * Columns that collect their data on demand use it to collect only while displayed.
+	 */
+	virtual void OnDisplayStateChanged(bool bDisplayed) {}
 };
 
 using SubsystemColumnPtr = TSharedPtr<FSubsystemDynamicColumn>;
@@ -0,0 +1,242 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserDataBreakpoints.h"
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserStyle.h"
+#include "SubsystemBrowserTrace.h"
+#include "SubsystemBrowserUtils.h"
+#include "Editor.h"
+#include "PropertyEditorModule.h"
+#include "PropertyHandle.h"
+#include "Framework/Commands/UIAction.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UnrealType.h"
+
+#define LOCTEXT_NAMESPACE "SubsystemBrowser"
+
+FSubsystemDataBreakpoint::FSubsystemDataBreakpoint(UObject* InObject, const FProperty* InProperty, const void* InValuePtr, const FString& InPath)
+	: Object(InObject), Path(InPath), Property(InProperty), ValuePtr(InValuePtr)
+{
+	bPlainData = Property->HasAnyPropertyFlags(CPF_IsPlainOldData);
+
+	// property initializers operate on all static array elements, only first one is compared
+	LastValue = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+	Property->InitializeValue(LastValue);
+	Property->CopySingleValue(LastValue, ValuePtr);
+}
+
+FSubsystemDataBreakpoint::~FSubsystemDataBreakpoint()
+{
+	Property->DestroyValue(LastValue);
+	FMemory::Free(LastValue);
+}
+
+bool FSubsystemDataBreakpoint::CheckChanged(FString* OutOldValue, FString* OutNewValue)
+{
+	const bool bChanged = bPlainData
+		? FMemory::Memcmp(LastValue, ValuePtr, Property->ElementSize) != 0
+		: !Property->Identical(LastValue, ValuePtr, PPF_None);
+
+	if (bChanged)
+	{
+		if (OutOldValue) *OutOldValue = ExportValue(LastValue);
+		if (OutNewValue) *OutNewValue = ExportValue(ValuePtr);
+
+		Property->CopySingleValue(LastValue, ValuePtr);
+	}
+
+	return bChanged;
+}
+
+FString FSubsystemDataBreakpoint::ExportValue(const void* InValue) const
+{
+	FString Result;
+#if UE_VERSION_OLDER_THAN(5,1,0)
+	Property->ExportTextItem(Result, InValue, nullptr, Object.Get(), PPF_None);
+#else
+	Property->ExportTextItem_Direct(Result, InValue, nullptr, Object.Get(), PPF_None);
+#endif
+	return Result;
+}
+
+FSubsystemDataBreakpoints::~FSubsystemDataBreakpoints()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+}
+
+void FSubsystemDataBreakpoints::Register()
+{
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+	FPropertyEditorModule& EditModule = FModuleManager::Get().LoadModuleChecked<FPropertyEditorModule>(TEXT("PropertyEditor"));
+	RowExtensionHandle = EditModule.GetGlobalRowExtensionDelegate().AddRaw(this, &FSubsystemDataBreakpoints::HandleGenerateRowExtension);
+#endif
+}
+
+void FSubsystemDataBreakpoints::Unregister()
+{
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+	if (FPropertyEditorModule* EditModule = FModuleManager::GetModulePtr<FPropertyEditorModule>(TEXT("PropertyEditor")))
+	{
+		EditModule->GetGlobalRowExtensionDelegate().Remove(RowExtensionHandle);
+	}
+	RowExtensionHandle.Reset();
+#endif
+
+	RemoveAllBreakpoints();
+}
+
+bool FSubsystemDataBreakpoints::AddBreakpoint(const TSharedPtr<IPropertyHandle>& InHandle)
+{
+	UObject* Object = nullptr;
+	void* ValuePtr = nullptr;
+	if (!FSubsystemBrowserUtils::ResolveStableValueAddress(InHandle, Object, ValuePtr))
+		return false;
+
+	const FString Path = InHandle->GeneratePathToProperty();
+	if (HasBreakpoint(Object, Path))
+		return true;
+
+	Breakpoints.Add(MakeUnique<FSubsystemDataBreakpoint>(Object, InHandle->GetProperty(), ValuePtr, Path));
+
+	UE_LOG(LogSubsystemBrowser, Log, TEXT("Added data breakpoint on %s of %s"), *Path, *GetNameSafe(Object));
+
+	UpdateBinding();
+	return true;
+}
+
+void FSubsystemDataBreakpoints::RemoveBreakpoint(const UObject* InObject, const FString& InPath)
+{
+	Breakpoints.RemoveAll([InObject, &InPath](const TUniquePtr<FSubsystemDataBreakpoint>& Breakpoint)
+	{
+		return Breakpoint->Object.Get() == InObject && Breakpoint->Path == InPath;
+	});
+
+	UpdateBinding();
+}
+
+void FSubsystemDataBreakpoints::ToggleBreakpoint(TWeakPtr<IPropertyHandle> InHandle)
+{
+	TSharedPtr<IPropertyHandle> Handle = InHandle.Pin();
+
+	UObject* Object = nullptr;
+	void* ValuePtr = nullptr;
+	if (!FSubsystemBrowserUtils::ResolveStableValueAddress(Handle, Object, ValuePtr))
+		return;
+
+	const FString Path = Handle->GeneratePathToProperty();
+	if (HasBreakpoint(Object, Path))
+	{
+		RemoveBreakpoint(Object, Path);
+	}
+	else
+	{
+		AddBreakpoint(Handle);
+	}
+}
+
+bool FSubsystemDataBreakpoints::HasBreakpoint(const UObject* InObject, const FString& InPath) const
+{
+	return Breakpoints.ContainsByPredicate([InObject, &InPath](const TUniquePtr<FSubsystemDataBreakpoint>& Breakpoint)
+	{
+		return Breakpoint->Object.Get() == InObject && Breakpoint->Path == InPath;
+	});
+}
+
+bool FSubsystemDataBreakpoints::HasHandleBreakpoint(TWeakPtr<IPropertyHandle> InHandle) const
+{
+	TSharedPtr<IPropertyHandle> Handle = InHandle.Pin();
+
+	UObject* Object = nullptr;
+	void* ValuePtr = nullptr;
+	return FSubsystemBrowserUtils::ResolveStableValueAddress(Handle, Object, ValuePtr)
+		&& HasBreakpoint(Object, Handle->GeneratePathToProperty());
+}
+
+void FSubsystemDataBreakpoints::RemoveAllBreakpoints()
+{
+	Breakpoints.Empty();
+	UpdateBinding();
+}
+
+void FSubsystemDataBreakpoints::CheckBreakpoints()
+{
+	SB_TRACE_SCOPE(FSubsystemDataBreakpoints::CheckBreakpoints);
+
+	// value addresses of destroyed objects are dangling, drop them before reading anything
+	const int32 NumRemoved = Breakpoints.RemoveAll([](const TUniquePtr<FSubsystemDataBreakpoint>& Breakpoint)
+	{
+		return !Breakpoint->Object.IsValid();
+	});
+
+	bool bTriggered = false;
+	FString OldValue, NewValue;
+
+	for (const TUniquePtr<FSubsystemDataBreakpoint>& Breakpoint : Breakpoints)
+	{
+		const UObject* Object = Breakpoint->Object.Get();
+		if (Breakpoint->CheckChanged(&OldValue, &NewValue))
+		{
+			UE_LOG(LogSubsystemBrowser, Warning, TEXT("Data breakpoint hit on frame %llu: %s of %s changed from '%s' to '%s'"),
+				(uint64)GFrameCounter, *Breakpoint->Path, *Object->GetName(), *OldValue, *NewValue);
+			bTriggered = true;
+		}
+	}
+
+	if (bTriggered)
+	{
+		if (GEditor && GEditor->PlayWorld && !GEditor->PlayWorld->bDebugPauseRequested)
+		{
+			GEditor->SetPIEWorldsPaused(true);
+		}
+
+		FSubsystemBrowserUtils::ShowBrowserInfoMessage(LOCTEXT("DataBreakpointHit", "Data breakpoint hit, see Output Log"), SNotificationItem::CS_Fail);
+	}
+
+	if (NumRemoved)
+	{
+		UE_LOG(LogSubsystemBrowser, Log, TEXT("Removed %d data breakpoints of destroyed objects"), NumRemoved);
+		UpdateBinding();
+	}
+}
+
+void FSubsystemDataBreakpoints::UpdateBinding()
+{
+	if (Breakpoints.Num() && !EndFrameHandle.IsValid())
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FSubsystemDataBreakpoints::CheckBreakpoints);
+	}
+	else if (!Breakpoints.Num() && EndFrameHandle.IsValid())
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		EndFrameHandle.Reset();
+	}
+}
+
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+void FSubsystemDataBreakpoints::HandleGenerateRowExtension(const FOnGenerateGlobalRowExtensionArgs& Args, TArray<FPropertyRowExtensionButton>& OutExtensions)
+{
+	UObject* Object = nullptr;
+	void* ValuePtr = nullptr;
+	if (!FSubsystemBrowserUtils::ResolveStableValueAddress(Args.PropertyHandle, Object, ValuePtr))
+		return;
+
+	// only offer breakpoints for subsystems and their subobjects
+	if (!FSubsystemBrowserUtils::IsSubsystemOrSubobject(Object))
+		return;
+
+	TWeakPtr<IPropertyHandle> WeakHandle = Args.PropertyHandle;
+
+	FPropertyRowExtensionButton& Button = OutExtensions.AddDefaulted_GetRef();
+	Button.Icon = FStyleHelper::GetSlateIcon("Icons.Error");
+	Button.Label = LOCTEXT("BreakOnChange", "Break on Change");
+	Button.ToolTip = LOCTEXT("BreakOnChange_Tooltip", "Pause play session and log old and new value when this value changes");
+	Button.UIAction = FUIAction(
+		FExecuteAction::CreateRaw(this, &FSubsystemDataBreakpoints::ToggleBreakpoint, WeakHandle),
+		FCanExecuteAction(),
+		FIsActionChecked::CreateRaw(this, &FSubsystemDataBreakpoints::HasHandleBreakpoint, WeakHandle)
+	);
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,82 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/WeakObjectPtr.h"
+
+class IPropertyHandle;
+class FProperty;
+struct FOnGenerateGlobalRowExtensionArgs;
+struct FPropertyRowExtensionButton;
+
+/**
+ * Breakpoint on value of a live object property.
+ * Keeps a copy of the value as of last check to compare against.
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemDataBreakpoint
+{
+	FSubsystemDataBreakpoint(UObject* InObject, const FProperty* InProperty, const void* InValuePtr, const FString& InPath);
+	~FSubsystemDataBreakpoint();
+
+	FSubsystemDataBreakpoint(const FSubsystemDataBreakpoint&) = delete;
+	FSubsystemDataBreakpoint& operator=(const FSubsystemDataBreakpoint&) = delete;
+
+	/* compare current value to last known one, store current value if it differs */
+	bool CheckChanged(FString* OutOldValue = nullptr, FString* OutNewValue = nullptr);
+
+	TWeakObjectPtr<UObject> Object;
+	/* property path as displayed in details view */
+	FString Path;
+
+private:
+	FString ExportValue(const void* InValue) const;
+
+	const FProperty* Property = nullptr;
+	const void* ValuePtr = nullptr;
+	/* plain data is compared with memcmp, anything else with Identical */
+	bool bPlainData = false;
+	/* copy of value made on last check */
+	void* LastValue = nullptr;
+};
+
+/**
+ * Registry of data breakpoints.
+ *
+ * Breakpoints are checked at the end of each frame while at least one exists, so nothing is paid otherwise.
+ * When watched value changes the report is logged and play session is paused.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemDataBreakpoints
+{
+public:
+	FSubsystemDataBreakpoints() = default;
+	~FSubsystemDataBreakpoints();
+
+	/* register details view row actions */
+	void Register();
+	void Unregister();
+
+	bool AddBreakpoint(const TSharedPtr<IPropertyHandle>& InHandle);
+	void RemoveBreakpoint(const UObject* InObject, const FString& InPath);
+	void ToggleBreakpoint(TWeakPtr<IPropertyHandle> InHandle);
+	bool HasBreakpoint(const UObject* InObject, const FString& InPath) const;
+	bool HasHandleBreakpoint(TWeakPtr<IPropertyHandle> InHandle) const;
+	void RemoveAllBreakpoints();
+
+	int32 GetNumBreakpoints() const { return Breakpoints.Num(); }
+
+	/* compare all breakpoints to their last values, report and pause on change. Breakpoints of destroyed objects are removed */
+	void CheckBreakpoints();
+
+private:
+	void UpdateBinding();
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+	void HandleGenerateRowExtension(const FOnGenerateGlobalRowExtensionArgs& Args, TArray<FPropertyRowExtensionButton>& OutExtensions);
+#endif
+
+	TArray<TUniquePtr<FSubsystemDataBreakpoint>> Breakpoints;
+
+	FDelegateHandle EndFrameHandle;
+	FDelegateHandle RowExtensionHandle;
+};
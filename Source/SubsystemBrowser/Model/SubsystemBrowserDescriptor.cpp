@@ -11,12 +11,19 @@
 #include "Model/SubsystemBrowserModel.h"
 #include "UI/SubsystemTableItemTooltip.h"
 #include "SubsystemBrowserStyle.h"
+#include "SubsystemBrowserTrace.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/PackageName.h"
 #include "UObject/Package.h"
 #include "Widgets/Views/SListView.h"
 
 #define LOCTEXT_NAMESPACE "SubsystemBrowser"
 
+bool ISubsystemTreeItem::WasChangedRecently(double InDuration) const
+{
+	return LastChangeTime > 0.0 && FPlatformTime::Seconds() - LastChangeTime < InDuration;
+}
+
 FSubsystemTreeCategoryItem::FSubsystemTreeCategoryItem(TSharedRef<FSubsystemModel> InModel, TSharedRef<FSubsystemCategory> InCategory)
 	: Data(InCategory)
 {
@@ -66,7 +73,7 @@ void FSubsystemTreeObjectItem::GenerateContextMenu(class UToolMenu* MenuBuilder)
 		FToolMenuSection& Section = MenuBuilder->AddSection(TEXT("SubsystemContextQuickActions"), LOCTEXT("SubsystemContextQuickActions", "Quick Actions"));
 		//Section.InsertPosition = FToolMenuInsert(TEXT("Common"), EToolMenuInsertType::After);
 		
-		if (QuickActions.Num() < USubsystemBrowserSettings::Get()->GetMaxQuickActionsToShow())
+		if (QuickActions.Num() < Model->GetSettings().GetMaxQuickActionsToShow())
 		{
 			for (const FSubsystemBrowserUtils::FQuickActionData& ActionData : QuickActions)
 			{
@@ -142,6 +149,8 @@ FText FSubsystemTreeObjectItem::GetDisplayName() const
 FSubsystemTreeSubsystemItem::FSubsystemTreeSubsystemItem(TSharedRef<FSubsystemModel> InModel, TSharedPtr<ISubsystemTreeItem> InParent, UObject* Instance)
 	: FSubsystemTreeObjectItem(InModel, InParent, Instance)
 {
+	SB_TRACE_STAT_SCOPE(FSubsystemTreeSubsystemItem::Construct, STAT_SubsystemBrowser_DescriptorConstruct);
+
 	UClass* const InClass = Instance->GetClass();
 
 	DisplayName = InClass->GetDisplayNameText();
@@ -198,6 +207,27 @@ FText FSubsystemTreeSubsystemItem::GetDisplayName() const
 	return DisplayName;
 }
 
+SIZE_T FSubsystemTreeSubsystemItem::GetAllocatedSize() const
+{
+	SIZE_T Result = sizeof(*this);
+	Result += Package.GetAllocatedSize();
+	Result += ScriptName.GetAllocatedSize();
+	Result += ModuleName.GetAllocatedSize();
+	Result += OwnerName.GetAllocatedSize();
+	Result += SourceFilePaths.GetAllocatedSize();
+	for (const FString& SourceFilePath : SourceFilePaths)
+	{
+		Result += SourceFilePath.GetAllocatedSize();
+	}
+	Result += PluginName.GetAllocatedSize();
+	Result += PluginDisplayName.GetAllocatedSize();
+	if (UserTooltip.IsSet())
+	{
+		Result += UserTooltip.GetValue().GetAllocatedSize();
+	}
+	return Result;
+}
+
 bool FSubsystemTreeSubsystemItem::HasViewableElements() const
 {
 	if (PropertyStats.NumProperties && PropertyStats.NumEditable)
@@ -277,6 +307,21 @@ void FSubsystemTreeSubsystemItem::GenerateContextMenu(UToolMenu* MenuBuilder) co
 				})
 			)
 		);
+		Section.AddMenuEntry("AnalyzeRetainedReferences",
+			LOCTEXT("AnalyzeRetainedReferences", "Analyze Retained References"),
+			LOCTEXT("AnalyzeRetainedReferencesTooltip", "Walk objects reachable from this subsystem and group them by class"),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateLambda([Self]()
+				{
+					if (Self.IsValid())
+					{
+						TSharedPtr<const FSubsystemTreeSubsystemItem> Pinned = Self.Pin();
+						Pinned->GetModel()->AnalyzeRetainedGraph(Pinned);
+					}
+				})
+			)
+		);
 	}
 	
 	{
@@ -286,9 +331,9 @@ void FSubsystemTreeSubsystemItem::GenerateContextMenu(UToolMenu* MenuBuilder) co
 			LOCTEXT("IgnorePackageTooltip", "Hide all subsystems from same module (Can be reverted in Settings)"),
 			FSlateIcon(),
 			FUIAction(
-				FExecuteAction::CreateLambda([Key = Package]()
+				FExecuteAction::CreateLambda([Settings = Model->GetSettingsRef(), Key = Package]()
 				{
-					USubsystemBrowserSettings::Get()->AddToIgnoreList(Key + TEXT("."), true);
+					Settings->AddToIgnoreList(Key + TEXT("."), true);
 				})
 			)
 		);
@@ -298,9 +343,9 @@ void FSubsystemTreeSubsystemItem::GenerateContextMenu(UToolMenu* MenuBuilder) co
 			LOCTEXT("IgnoreSubsystemTooltip", "Hide subsystem from list (Can be reverted in Settings)"),
 			FSlateIcon(),
 			FUIAction(
-				FExecuteAction::CreateLambda([Key = ScriptName]()
+				FExecuteAction::CreateLambda([Settings = Model->GetSettingsRef(), Key = ScriptName]()
 				{
-					USubsystemBrowserSettings::Get()->AddToIgnoreList(Key, false);
+					Settings->AddToIgnoreList(Key, false);
 				})
 			)
 		);
@@ -371,7 +416,7 @@ void FSubsystemTreeSubsystemItem::GenerateContextMenu(UToolMenu* MenuBuilder) co
 		}
 	}
 
-	if (IsConfigExportable() && USubsystemBrowserSettings::Get()->ShouldDisplayConfigExportActions())
+	if (IsConfigExportable() && Model->GetSettings().ShouldDisplayConfigExportActions())
 	{
 		FToolMenuSection& Section = MenuBuilder->AddSection("SubsystemConfigActions", LOCTEXT("SubsystemConfigActions", "Config"));
 
@@ -436,7 +481,163 @@ void FSubsystemTreeSubsystemItem::GenerateContextMenu(UToolMenu* MenuBuilder) co
 
 bool FSubsystemTreeSubsystemItem::CanHaveChildren() const
 {
-	return USubsystemBrowserSettings::Get()->ShouldShowSubobjbects() && bHasSubobjectPicker;
+	return (Model->GetSettings().ShouldShowSubobjects() && bHasSubobjectPicker)
+		|| Model->FindRetainedGraph(GetObjectForDetails()).IsValid();
+}
+
+FSubsystemTreeRetainedGraphItem::FSubsystemTreeRetainedGraphItem(TSharedRef<FSubsystemModel> InModel, TSharedPtr<ISubsystemTreeItem> InParent, TSharedRef<FSubsystemRetainedGraph> InGraph)
+	: Graph(InGraph)
+{
+	Model = InModel;
+	Parent = InParent;
+	// results are often large, do not expand them unasked
+	bExpanded = false;
+}
+
+FSubsystemTreeItemID FSubsystemTreeRetainedGraphItem::GetID() const
+{
+	return FName(*FString::Printf(TEXT("%s.RetainedReferences"), *Parent->GetID().ToString()));
+}
+
+FText FSubsystemTreeRetainedGraphItem::GetDisplayName() const
+{
+	FFormatNamedArguments Args;
+	Args.Add(TEXT("NumObjects"), FText::AsNumber(Graph->GetNumObjects()));
+	Args.Add(TEXT("Size"), FText::AsMemory(Graph->GetTotalBytes()));
+	Args.Add(TEXT("Status"), Graph->IsRunning() ? LOCTEXT("RetainedGraph_Running", " - Analyzing...")
+		: Graph->IsTruncated() ? LOCTEXT("RetainedGraph_Truncated", " - Truncated")
+		: FText::GetEmpty());
+	return FText::Format(LOCTEXT("RetainedGraph_Name", "Retained References ({NumObjects} objects, {Size}){Status}"), Args);
+}
+
+const TArray<SubsystemTreeItemPtr>& FSubsystemTreeRetainedGraphItem::GetChildren() const
+{
+	if (!ChildrenRevision.IsSet() || ChildrenRevision.GetValue() != Graph->GetRevision())
+	{
+		ChildrenRevision = Graph->GetRevision();
+
+		TArray<FSubsystemRetainedClassStats> SortedStats = Graph->GetClassStats();
+		SortedStats.Sort([](const FSubsystemRetainedClassStats& A, const FSubsystemRetainedClassStats& B)
+		{
+			return A.Bytes > B.Bytes;
+		});
+
+		const TSharedPtr<ISubsystemTreeItem> Self = ConstCastSharedRef<ISubsystemTreeItem>(AsShared());
+
+		Children.Empty(SortedStats.Num());
+		for (const FSubsystemRetainedClassStats& Stats : SortedStats)
+		{
+			Children.Add(MakeShared<FSubsystemTreeRetainedClassItem>(Model.ToSharedRef(), Self, Stats));
+		}
+	}
+	return Children;
+}
+
+void FSubsystemTreeRetainedGraphItem::GenerateTooltip(FSubsystemTableItemTooltipBuilder& TooltipBuilder) const
+{
+	TooltipBuilder.AddPrimary(LOCTEXT("RetainedGraphTooltip_Objects", "Objects"), FText::AsNumber(Graph->GetNumObjects()));
+	TooltipBuilder.AddPrimary(LOCTEXT("RetainedGraphTooltip_Size", "Size"), FText::AsMemory(Graph->GetTotalBytes()));
+	TooltipBuilder.AddPrimary(LOCTEXT("RetainedGraphTooltip_Classes", "Classes"), FText::AsNumber(Graph->GetClassStats().Num()));
+	TooltipBuilder.AddPrimary(LOCTEXT("RetainedGraphTooltip_OtherWorlds", "In Other Worlds"), FText::AsNumber(Graph->GetNumInOtherWorlds()));
+	TooltipBuilder.AddPrimary(LOCTEXT("RetainedGraphTooltip_Transient", "In Transient Package"), FText::AsNumber(Graph->GetNumInTransientPackage()));
+}
+
+void FSubsystemTreeRetainedGraphItem::GenerateContextMenu(UToolMenu* MenuBuilder) const
+{
+	TWeakPtr<FSubsystemRetainedGraph> WeakGraph = Graph;
+	TWeakPtr<FSubsystemModel> WeakModel = Model;
+
+	FToolMenuSection& Section = MenuBuilder->AddSection("SubsystemContextAnalysis", LOCTEXT("SubsystemContextAnalysis", "Analysis"));
+	Section.AddMenuEntry("RefreshRetainedReferences",
+		LOCTEXT("RefreshRetainedReferences", "Refresh Analysis"),
+		LOCTEXT("RefreshRetainedReferencesTooltip", "Walk references of subsystem again"),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateLambda([WeakGraph]()
+			{
+				if (TSharedPtr<FSubsystemRetainedGraph> Pinned = WeakGraph.Pin())
+				{
+					Pinned->Start();
+				}
+			})
+		)
+	);
+	Section.AddMenuEntry("ClearRetainedReferences",
+		LOCTEXT("ClearRetainedReferences", "Clear Analysis"),
+		LOCTEXT("ClearRetainedReferencesTooltip", "Remove analysis results from the tree"),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateLambda([WeakGraph, WeakModel]()
+			{
+				TSharedPtr<FSubsystemRetainedGraph> PinnedGraph = WeakGraph.Pin();
+				TSharedPtr<FSubsystemModel> PinnedModel = WeakModel.Pin();
+				if (PinnedGraph.IsValid() && PinnedModel.IsValid())
+				{
+					PinnedModel->ClearRetainedGraph(PinnedGraph->GetRoot());
+				}
+			})
+		)
+	);
+}
+
+FSubsystemTreeRetainedClassItem::FSubsystemTreeRetainedClassItem(TSharedRef<FSubsystemModel> InModel, TSharedPtr<ISubsystemTreeItem> InParent, const FSubsystemRetainedClassStats& InStats)
+	: Stats(InStats)
+{
+	Model = InModel;
+	Parent = InParent;
+}
+
+FSubsystemTreeItemID FSubsystemTreeRetainedClassItem::GetID() const
+{
+	return FName(*FString::Printf(TEXT("%s.%s"), *Parent->GetID().ToString(), *Stats.ClassName));
+}
+
+FText FSubsystemTreeRetainedClassItem::GetDisplayName() const
+{
+	FFormatNamedArguments Args;
+	Args.Add(TEXT("Class"), FText::FromString(Stats.ClassName));
+	Args.Add(TEXT("NumObjects"), FText::AsNumber(Stats.NumObjects));
+	Args.Add(TEXT("Size"), FText::AsMemory(Stats.Bytes));
+	Args.Add(TEXT("Warning"), Stats.HasWarnings() ? LOCTEXT("RetainedClass_Warning", " [!]") : FText::GetEmpty());
+	return FText::Format(LOCTEXT("RetainedClass_Name", "{Class} x{NumObjects} ({Size}){Warning}"), Args);
+}
+
+void FSubsystemTreeRetainedClassItem::GenerateTooltip(FSubsystemTableItemTooltipBuilder& TooltipBuilder) const
+{
+	TooltipBuilder.AddPrimary(LOCTEXT("SubsystemTooltipItem_Class", "Class"), FText::FromString(Stats.ClassName));
+	TooltipBuilder.AddPrimary(LOCTEXT("RetainedGraphTooltip_Objects", "Objects"), FText::AsNumber(Stats.NumObjects));
+	TooltipBuilder.AddPrimary(LOCTEXT("RetainedGraphTooltip_Size", "Size"), FText::AsMemory(Stats.Bytes));
+	if (Stats.NumInOtherWorlds)
+	{
+		TooltipBuilder.AddPrimary(LOCTEXT("RetainedGraphTooltip_OtherWorlds", "In Other Worlds"), FText::AsNumber(Stats.NumInOtherWorlds));
+	}
+	if (Stats.NumInTransientPackage)
+	{
+		TooltipBuilder.AddPrimary(LOCTEXT("RetainedGraphTooltip_Transient", "In Transient Package"), FText::AsNumber(Stats.NumInTransientPackage));
+	}
+	if (UObject* Sample = Stats.SampleObject.Get())
+	{
+		TooltipBuilder.AddSecondary(LOCTEXT("RetainedGraphTooltip_Sample", "Sample"), FText::FromString(Sample->GetPathName()));
+	}
+}
+
+void FSubsystemTreeRetainedClassItem::GenerateContextMenu(UToolMenu* MenuBuilder) const
+{
+	FToolMenuSection& Section = MenuBuilder->AddSection("SubsystemReferenceActions", LOCTEXT("SubsystemReferenceActions", "References"));
+	Section.AddMenuEntry("CopySamplePath",
+		LOCTEXT("CopySamplePath", "Copy Sample Object Path"),
+		FText::GetEmpty(),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateLambda([Sample = Stats.SampleObject]()
+			{
+				if (Sample.IsValid())
+				{
+					FSubsystemBrowserUtils::SetClipboardText(Sample->GetPathName());
+				}
+			})
+		)
+	);
 }
 
 #undef LOCTEXT_NAMESPACE
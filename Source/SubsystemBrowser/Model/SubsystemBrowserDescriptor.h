@@ -4,6 +4,7 @@
 
 #include "SubsystemBrowserUtils.h"
 #include "Model/SubsystemBrowserCategory.h"
+#include "Model/SubsystemBrowserRetainedGraph.h"
 #include "Misc/TextFilter.h"
 #include "Misc/Optional.h"
 #include "Templates/SharedPointer.h"
@@ -28,7 +29,8 @@ struct SUBSYSTEMBROWSER_API ISubsystemTreeItem : public TSharedFromThis<ISubsyst
 	{
 		Category,
 		Object,
-		Subsystem
+		Subsystem,
+		Analysis
 	};
 
 	ISubsystemTreeItem() = default;
@@ -62,11 +64,16 @@ struct SUBSYSTEMBROWSER_API ISubsystemTreeItem : public TSharedFromThis<ISubsyst
 	virtual const FSlateBrush* GetIcon() const { return nullptr; } 
 	virtual void GenerateTooltip(class FSubsystemTableItemTooltipBuilder& TooltipBuilder) const {}
 	virtual void GenerateContextMenu(class UToolMenu* MenuBuilder) const { }
+
+	/* was reflected state of this item detected as changed within specified number of seconds */
+	bool WasChangedRecently(double InDuration) const;
 public:
 	bool bExpanded = true;
 	bool bVisible = true;
 	bool bNeedsRefresh = true;
 	bool bChildrenRequireSort = false;
+	/* time when change detection last reported this item as changed */
+	double LastChangeTime = 0.0;
 
 	TSharedPtr<FSubsystemModel> Model;
 	mutable SubsystemTreeItemPtr Parent;
@@ -155,6 +162,9 @@ public:
 	virtual bool CanHaveChildren() const override;
 	
 	virtual const FSubsystemTreeSubsystemItem* GetAsSubsystemDescriptor() const override { return this; }
+
+	/* get approximate memory used by this descriptor */
+	SIZE_T GetAllocatedSize() const;
 	
 public:
 	// Friendly display name (Class Name)
@@ -197,3 +207,52 @@ public:
 	bool							bHasSubobjectPicker = false;
 	//TArray<TWeakObjectPtr<UObject>> SubobjectsToDisplay;
 };
+
+/**
+ * Node holding results of retained references analysis of parent subsystem.
+ * Children are created from analysis results on demand and recreated when results change.
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemTreeRetainedGraphItem : public ISubsystemTreeItem
+{
+private:
+	using Super = ISubsystemTreeItem;
+public:
+	FSubsystemTreeRetainedGraphItem(TSharedRef<FSubsystemModel> InModel, TSharedPtr<ISubsystemTreeItem> InParent, TSharedRef<FSubsystemRetainedGraph> InGraph);
+
+	virtual EItemType GetType() const override { return EItemType::Analysis; }
+	virtual FSubsystemTreeItemID GetID() const override;
+	virtual FText GetDisplayName() const override;
+	virtual bool IsStale() const override { return Graph->GetRoot() == nullptr; }
+
+	virtual bool CanHaveChildren() const override { return true; }
+	virtual const TArray<SubsystemTreeItemPtr>& GetChildren() const override;
+	virtual int32 GetNumChildren() const override { return GetChildren().Num(); }
+
+	virtual void GenerateTooltip(class FSubsystemTableItemTooltipBuilder& TooltipBuilder) const override;
+	virtual void GenerateContextMenu(class UToolMenu* MenuBuilder) const override;
+public:
+	TSharedRef<FSubsystemRetainedGraph> Graph;
+	/* revision of analysis results current children were made from */
+	mutable TOptional<uint32> ChildrenRevision;
+};
+
+/**
+ * Node representing objects of one class retained by subsystem
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemTreeRetainedClassItem : public ISubsystemTreeItem
+{
+private:
+	using Super = ISubsystemTreeItem;
+public:
+	FSubsystemTreeRetainedClassItem(TSharedRef<FSubsystemModel> InModel, TSharedPtr<ISubsystemTreeItem> InParent, const FSubsystemRetainedClassStats& InStats);
+
+	virtual EItemType GetType() const override { return EItemType::Analysis; }
+	virtual FSubsystemTreeItemID GetID() const override;
+	virtual FText GetDisplayName() const override;
+	virtual bool IsStale() const override { return Stats.Class.IsStale(); }
+
+	virtual void GenerateTooltip(class FSubsystemTableItemTooltipBuilder& TooltipBuilder) const override;
+	virtual void GenerateContextMenu(class UToolMenu* MenuBuilder) const override;
+public:
+	FSubsystemRetainedClassStats Stats;
+};
@@ -0,0 +1,170 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserMemoryStats.h"
+
+#include "SubsystemBrowserTrace.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/ResourceSize.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/UObjectHash.h"
+
+namespace SubsystemMemoryStats
+{
+	/* maximum time to spend measuring per frame */
+	static constexpr double FrameBudget = 0.001;
+	/* age in seconds after which cached result is measured again */
+	static constexpr double RefreshInterval = 10.0;
+}
+
+FSubsystemMemoryStats::~FSubsystemMemoryStats()
+{
+	FTickerHelper::RemoveTicker(TickerHandle);
+}
+
+const FSubsystemMemoryInfo* FSubsystemMemoryStats::Find(const UObject* InObject)
+{
+	if (!InObject)
+	{
+		return nullptr;
+	}
+
+	const FSubsystemMemoryInfo* Info = Cache.Find(InObject);
+	if (!Info || FPlatformTime::Seconds() - Info->MeasureTime > SubsystemMemoryStats::RefreshInterval)
+	{
+		Schedule(InObject);
+	}
+	return Info;
+}
+
+void FSubsystemMemoryStats::Reset()
+{
+	FTickerHelper::RemoveTicker(TickerHandle);
+	Cache.Empty();
+	Queue.Empty();
+	QueuedObjects.Empty();
+	CurrentJob.Reset();
+}
+
+uint64 FSubsystemMemoryStats::MeasureObject(const UObject* InObject)
+{
+	UObject* const Object = const_cast<UObject*>(InObject);
+
+	FArchiveCountMem CountMem(Object);
+
+	FResourceSizeEx ResourceSize(EResourceSizeMode::Exclusive);
+	Object->GetResourceSizeEx(ResourceSize);
+
+	return (uint64)CountMem.GetMax() + (uint64)ResourceSize.GetTotalMemoryBytes();
+}
+
+void FSubsystemMemoryStats::Schedule(const UObject* InObject)
+{
+	const bool bInProgress = CurrentJob.IsSet() && CurrentJob->Object.Get() == InObject;
+	if (!bInProgress)
+	{
+		bool bAlreadyQueued = false;
+		QueuedObjects.Add(InObject, &bAlreadyQueued);
+		if (!bAlreadyQueued)
+		{
+			Queue.Add(InObject);
+		}
+	}
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTickerHelper::AddTicker(FTickerDelegate::CreateRaw(this, &FSubsystemMemoryStats::HandleTick));
+	}
+}
+
+bool FSubsystemMemoryStats::HandleTick(float DeltaTime)
+{
+	SB_TRACE_SCOPE(FSubsystemMemoryStats::HandleTick);
+
+	const double StartTime = FPlatformTime::Seconds();
+	while (Step())
+	{
+		if (FPlatformTime::Seconds() - StartTime >= SubsystemMemoryStats::FrameBudget)
+		{
+			return true;
+		}
+	}
+
+	// nothing left to measure, ticker is removed by returning false
+	TickerHandle.Reset();
+	return false;
+}
+
+bool FSubsystemMemoryStats::Step()
+{
+	if (!CurrentJob.IsSet())
+	{
+		while (Queue.Num() && !Queue[0].IsValid())
+		{
+			QueuedObjects.Remove(Queue[0]);
+			Queue.RemoveAt(0, 1, false);
+		}
+
+		if (!Queue.Num())
+		{
+			QueuedObjects.Empty();
+
+			// results of destroyed objects are not needed anymore
+			for (auto It = Cache.CreateIterator(); It; ++It)
+			{
+				if (!It.Key().IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+			return false;
+		}
+
+		CurrentJob.Emplace();
+		CurrentJob->Object = Queue[0];
+		QueuedObjects.Remove(Queue[0]);
+		Queue.RemoveAt(0, 1, false);
+	}
+
+	FJob& Job = CurrentJob.GetValue();
+
+	const UObject* Object = Job.Object.Get();
+	if (!Object)
+	{
+		CurrentJob.Reset();
+		return true;
+	}
+
+	if (Job.NextInner == INDEX_NONE)
+	{
+		Job.Info.ExclusiveBytes = MeasureObject(Object);
+		Job.Info.InclusiveBytes = Job.Info.ExclusiveBytes;
+
+		TArray<UObject*> Inners;
+		GetObjectsWithOuter(Object, Inners, true);
+		Job.Inners.Reserve(Inners.Num());
+		for (UObject* Inner : Inners)
+		{
+			Job.Inners.Add(Inner);
+		}
+
+		Job.Info.NumInners = Job.Inners.Num();
+		Job.NextInner = 0;
+	}
+	else if (Job.Inners.IsValidIndex(Job.NextInner))
+	{
+		if (const UObject* Inner = Job.Inners[Job.NextInner].Get())
+		{
+			Job.Info.InclusiveBytes += MeasureObject(Inner);
+		}
+		Job.NextInner++;
+	}
+
+	if (Job.NextInner >= Job.Inners.Num())
+	{
+		Job.Info.MeasureTime = FPlatformTime::Seconds();
+		Cache.Add(Job.Object, Job.Info);
+		CurrentJob.Reset();
+	}
+
+	return true;
+}
@@ -0,0 +1,67 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SubsystemBrowserTicker.h"
+#include "UObject/WeakObjectPtr.h"
+
+/**
+ * Measured memory footprint of an object
+ */
+struct FSubsystemMemoryInfo
+{
+	/* serialized size and exclusive resource size of object itself */
+	uint64 ExclusiveBytes = 0;
+	/* exclusive size plus sizes of all objects it owns as outer */
+	uint64 InclusiveBytes = 0;
+	int32 NumInners = 0;
+	/* time of measurement completion */
+	double MeasureTime = 0.0;
+};
+
+/**
+ * Cache of object memory footprints measured on game thread in time slices.
+ *
+ * Each object is measured with FArchiveCountMem and GetResourceSizeEx, its owned inners are measured
+ * one by one, so a single large subsystem is spread over multiple frames too.
+ * Cached results are served immediately and refreshed in background once outdated.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemMemoryStats
+{
+public:
+	FSubsystemMemoryStats() = default;
+	~FSubsystemMemoryStats();
+
+	/* get cached footprint of object, schedules measurement when missing or outdated */
+	const FSubsystemMemoryInfo* Find(const UObject* InObject);
+	/* drop all cached results and pending measurements */
+	void Reset();
+
+	bool IsMeasuring() const { return TickerHandle.IsValid(); }
+
+	/* measure memory of object itself */
+	static uint64 MeasureObject(const UObject* InObject);
+
+private:
+	bool HandleTick(float DeltaTime);
+	void Schedule(const UObject* InObject);
+	/* perform one unit of work, returns false when nothing is left */
+	bool Step();
+
+	struct FJob
+	{
+		TWeakObjectPtr<const UObject> Object;
+		TArray<TWeakObjectPtr<const UObject>> Inners;
+		int32 NextInner = INDEX_NONE;
+		FSubsystemMemoryInfo Info;
+	};
+
+	TMap<TWeakObjectPtr<const UObject>, FSubsystemMemoryInfo> Cache;
+	TArray<TWeakObjectPtr<const UObject>> Queue;
+	/* objects in queue, queried on every paint so lookup must not scan the queue */
+	TSet<TWeakObjectPtr<const UObject>> QueuedObjects;
+	TOptional<FJob> CurrentJob;
+
+	FTickerHelper::FHandle TickerHandle;
+};
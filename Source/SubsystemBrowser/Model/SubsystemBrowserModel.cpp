@@ -2,15 +2,21 @@
 
 #include "Model/SubsystemBrowserModel.h"
 
-#include "SubsystemBrowserModule.h"
-#include "SubsystemBrowserSettings.h"
+#include "SubsystemBrowserTrace.h"
+#include "HAL/PlatformTime.h"
 
 #define LOCTEXT_NAMESPACE "SubsystemBrowser"
 
 SubsystemCategoryFilter::SubsystemCategoryFilter()
+	: SubsystemCategoryFilter(FSubsystemModelSettings_Browser::Get())
+{
+}
+
+SubsystemCategoryFilter::SubsystemCategoryFilter(TSharedRef<ISubsystemModelSettings> InSettings)
+	: Settings(InSettings)
 {
 	// load initial state from config
-	USubsystemBrowserSettings::Get()->LoadCategoryStates(FilterState);
+	Settings->LoadCategoryStates(FilterState);
 }
 
 bool SubsystemCategoryFilter::PassesFilter(const ISubsystemTreeItem& InItem) const
@@ -21,14 +27,14 @@ bool SubsystemCategoryFilter::PassesFilter(const ISubsystemTreeItem& InItem) con
 void SubsystemCategoryFilter::ShowCategory(FSubsystemTreeItemID InCategory)
 {
 	FilterState.Add(InCategory, true);
-	USubsystemBrowserSettings::Get()->SetCategoryState(InCategory, true);
+	Settings->SetCategoryState(InCategory, true);
 	OnChangedInternal.Broadcast();
 }
 
 void SubsystemCategoryFilter::HideCategory(FSubsystemTreeItemID InCategory)
 {
 	FilterState.Add(InCategory, false);
-	USubsystemBrowserSettings::Get()->SetCategoryState(InCategory, false);
+	Settings->SetCategoryState(InCategory, false);
 	OnChangedInternal.Broadcast();
 }
 
@@ -38,8 +44,21 @@ bool SubsystemCategoryFilter::IsCategoryVisible(FSubsystemTreeItemID InCategory)
 }
 
 FSubsystemModel::FSubsystemModel()
+	: FSubsystemModel(FSubsystemModelSettings_Browser::Get(), FSubsystemModelProvider_Browser::Get())
+{
+}
+
+FSubsystemModel::FSubsystemModel(TSharedRef<ISubsystemModelSettings> InSettings, TSharedRef<ISubsystemModelProvider> InProvider)
+	: Settings(InSettings)
+	, Provider(InProvider)
+	, PerfStats(TEXT("Browser Panel"))
+{
+	Provider->GetPermanentColumns(PermanentColumns);
+}
+
+FSubsystemModel::~FSubsystemModel()
 {
-	FSubsystemBrowserModule::AddPermanentColumns(PermanentColumns);
+	FSubsystemBrowserTrace::ModifyModelItems(-AllCategories.Num(), -AllSubsystems.Num(), -DescriptorBytes);
 }
 
 TWeakObjectPtr<UWorld> FSubsystemModel::GetCurrentWorld() const
@@ -49,6 +68,9 @@ TWeakObjectPtr<UWorld> FSubsystemModel::GetCurrentWorld() const
 
 void FSubsystemModel::SetCurrentWorld(TWeakObjectPtr<UWorld> InWorld)
 {
+	SB_TRACE_STAT_SCOPE(FSubsystemModel::SetCurrentWorld, STAT_SubsystemBrowser_ModelPopulate);
+	FSubsystemPerfStats::FScope PerfScope(PerfStats, ESubsystemPerfMetric::Populate);
+
 	UE_LOG(LogSubsystemBrowser, Log, TEXT("World Switch %s => %s"), *GetNameSafe(CurrentWorld.Get()), *GetNameSafe(InWorld.Get()));
 
 	CurrentWorld = InWorld;
@@ -57,6 +79,8 @@ void FSubsystemModel::SetCurrentWorld(TWeakObjectPtr<UWorld> InWorld)
 
 	PopulateCategories();
 	PopulateSubsystems();
+
+	PerfScope.SetNumItems(AllSubsystems.Num());
 }
 
 bool FSubsystemModel::IsSubsystemFilterActive() const
@@ -64,7 +88,6 @@ bool FSubsystemModel::IsSubsystemFilterActive() const
 	if (SubsystemTextFilter.IsValid() && SubsystemTextFilter->HasText())
 		return true;
 
-	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
 	if (Settings->ShouldShowOnlyGame())
 		return true;
 	if (Settings->ShouldShowOnlyPlugins())
@@ -89,6 +112,8 @@ const TArray<SubsystemTreeItemPtr>& FSubsystemModel::GetAllCategories() const
 
 void FSubsystemModel::GetFilteredCategories(TArray<SubsystemTreeItemPtr>& OutCategories)
 {
+	SB_TRACE_SCOPE(FSubsystemModel::GetFilteredCategories);
+
 	OutCategories.Empty();
 
 	for (const SubsystemTreeItemPtr& Item : GetAllCategories())
@@ -99,7 +124,7 @@ void FSubsystemModel::GetFilteredCategories(TArray<SubsystemTreeItemPtr>& OutCat
 			continue;
 		}
 
-		if (USubsystemBrowserSettings::Get()->ShouldHideEmptyCategories()
+		if (Settings->ShouldHideEmptyCategories()
 			&& !GetNumSubsystemsFromCategory(Item))
 		{
 			continue;
@@ -130,13 +155,13 @@ void FSubsystemModel::GetAllSubsystemsInCategory(SubsystemTreeItemConstPtr Categ
 
 void FSubsystemModel::GetFilteredSubsystems(SubsystemTreeItemConstPtr Category, TArray<SubsystemTreeItemPtr>& OutChildren)
 {
+	SB_TRACE_STAT_SCOPE(FSubsystemModel::GetFilteredSubsystems, STAT_SubsystemBrowser_ModelFilter);
+
 	const FSubsystemTreeCategoryItem* AsCategory = Category->GetAsCategoryDescriptor();
 	check(AsCategory);
 
 	OutChildren.Empty();
 
-	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
-
 	if (AllSubsystemsByCategory.Contains(AsCategory->GetID()))
 	{
 		for (const SubsystemTreeItemPtr& Item : AllSubsystemsByCategory.FindChecked(AsCategory->GetID()))
@@ -164,6 +189,8 @@ void FSubsystemModel::GetFilteredSubsystems(SubsystemTreeItemConstPtr Category,
 
 void FSubsystemModel::GetSubsystemSubobjects(SubsystemTreeItemConstPtr Subsystem, TArray<SubsystemTreeItemPtr>& OutChildren)
 {
+	SB_TRACE_SCOPE(FSubsystemModel::GetSubsystemSubobjects);
+
 	const FSubsystemTreeSubsystemItem* AsSubsystem = Subsystem->GetAsSubsystemDescriptor();
 	check(AsSubsystem);
 	const FSubsystemTreeCategoryItem* AsCategory = AsSubsystem->GetParent()->GetAsCategoryDescriptor();
@@ -171,8 +198,7 @@ void FSubsystemModel::GetSubsystemSubobjects(SubsystemTreeItemConstPtr Subsystem
 	
 	OutChildren.Empty();
 	
-	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
-	if (!Settings->ShouldShowSubobjbects())
+	if (!Settings->ShouldShowSubobjects())
 		return;
 
 	TArray<UObject*> Result;
@@ -186,6 +212,52 @@ void FSubsystemModel::GetSubsystemSubobjects(SubsystemTreeItemConstPtr Subsystem
 	}
 }
 
+void FSubsystemModel::AnalyzeRetainedGraph(SubsystemTreeItemConstPtr Subsystem)
+{
+	UObject* const Object = Subsystem.IsValid() ? Subsystem->GetObjectForDetails() : nullptr;
+	if (!Object)
+		return;
+
+	const TSharedRef<FSubsystemRetainedGraph>* Existing = RetainedGraphs.Find(Object);
+	if (!Existing)
+	{
+		TSharedRef<FSubsystemRetainedGraph> Graph = MakeShared<FSubsystemRetainedGraph>(Object, CurrentWorld.Get());
+		Graph->OnUpdated.AddSP(this, &FSubsystemModel::HandleRetainedGraphUpdated);
+		Existing = &RetainedGraphs.Add(Object, Graph);
+
+		OnHierarchyChanged.Broadcast();
+	}
+
+	(*Existing)->Start();
+}
+
+void FSubsystemModel::ClearRetainedGraph(const UObject* InObject)
+{
+	if (RetainedGraphs.Remove(InObject))
+	{
+		OnHierarchyChanged.Broadcast();
+	}
+}
+
+TSharedPtr<FSubsystemRetainedGraph> FSubsystemModel::FindRetainedGraph(const UObject* InObject) const
+{
+	const TSharedRef<FSubsystemRetainedGraph>* Graph = InObject ? RetainedGraphs.Find(InObject) : nullptr;
+	return Graph ? TSharedPtr<FSubsystemRetainedGraph>(*Graph) : nullptr;
+}
+
+void FSubsystemModel::GetSubsystemRetainedGraph(SubsystemTreeItemConstPtr Subsystem, TArray<SubsystemTreeItemPtr>& OutChildren)
+{
+	if (TSharedPtr<FSubsystemRetainedGraph> Graph = FindRetainedGraph(Subsystem->GetObjectForDetails()))
+	{
+		OutChildren.Emplace(MakeShared<FSubsystemTreeRetainedGraphItem>(SharedThis(this), ConstCastSharedPtr<ISubsystemTreeItem>(Subsystem), Graph.ToSharedRef()));
+	}
+}
+
+void FSubsystemModel::HandleRetainedGraphUpdated()
+{
+	OnRetainedGraphUpdated.Broadcast();
+}
+
 int32 FSubsystemModel::GetNumSubsystemsFromCategory(SubsystemTreeItemConstPtr Category)
 {
 	TArray<SubsystemTreeItemPtr> Subsystems;
@@ -214,7 +286,7 @@ int32 FSubsystemModel::GetNumSubsystemsFromVisibleCategories()
 
 int32 FSubsystemModel::GetNumDynamicColumns() const
 {
-	return FSubsystemBrowserModule::Get().GetDynamicColumns().Num();
+	return Provider->GetDynamicColumns().Num();
 }
 
 bool FSubsystemModel::ShouldShowColumn(SubsystemColumnPtr Column) const
@@ -222,7 +294,27 @@ bool FSubsystemModel::ShouldShowColumn(SubsystemColumnPtr Column) const
 	if (PermanentColumns.Contains(Column))
 		return true;
 
-	return USubsystemBrowserSettings::Get()->GetTableColumnState(Column->Name);
+	return Settings->GetTableColumnState(Column->Name);
+}
+
+void FSubsystemModel::GetConfigExportableSubsystems(TArray<UObject*>& OutObjects) const
+{
+	for (const SubsystemTreeItemPtr& Item : AllSubsystems)
+	{
+		const FSubsystemTreeSubsystemItem* AsSubsystem = Item->GetAsSubsystemDescriptor();
+		if (AsSubsystem && AsSubsystem->IsConfigExportable() && !AsSubsystem->IsStale())
+		{
+			OutObjects.Add(AsSubsystem->GetObjectForDetails());
+		}
+	}
+}
+
+void FSubsystemModel::GetSettingsObjects(TArray<UObject*>& OutObjects) const
+{
+	for (const SubsystemCategoryPtr& Category : Provider->GetCategories())
+	{
+		Category->SelectSettings(OutObjects);
+	}
 }
 
 bool FSubsystemModel::IsItemSelected(TSharedRef<const ISubsystemTreeItem> Item)
@@ -240,14 +332,28 @@ void FSubsystemModel::NotifySelected(TSharedPtr<ISubsystemTreeItem> Item)
 	OnSelectionChanged.Broadcast(Item);
 }
 
-TArray<SubsystemColumnPtr> FSubsystemModel::GetSelectedTableColumns() const
+void FSubsystemModel::TickChangeDetection(uint32 InFrameInterval, double InBudgetSeconds)
 {
-	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
+	TArray<SubsystemTreeItemPtr> ChangedItems;
+	ChangeSampler.Tick(InFrameInterval, InBudgetSeconds, ChangedItems);
 
+	if (ChangedItems.Num())
+	{
+		const double Now = FPlatformTime::Seconds();
+		for (const SubsystemTreeItemPtr& Item : ChangedItems)
+		{
+			Item->LastChangeTime = Now;
+			OnDataChanged.Broadcast(Item.ToSharedRef());
+		}
+	}
+}
+
+TArray<SubsystemColumnPtr> FSubsystemModel::GetSelectedTableColumns() const
+{
 	TArray<SubsystemColumnPtr> Result;
 	Result.Append(PermanentColumns);
 
-	for (const SubsystemColumnPtr& Column : FSubsystemBrowserModule::Get().GetDynamicColumns())
+	for (const SubsystemColumnPtr& Column : Provider->GetDynamicColumns())
 	{
 		if (Settings->GetTableColumnState(Column->Name))
 		{
@@ -262,7 +368,7 @@ TArray<SubsystemColumnPtr> FSubsystemModel::GetSelectedTableColumns() const
 TArray<SubsystemColumnPtr> FSubsystemModel::GetDynamicTableColumns() const
 {
 	TArray<SubsystemColumnPtr> Result;
-	Result.Append(FSubsystemBrowserModule::Get().GetDynamicColumns());
+	Result.Append(Provider->GetDynamicColumns());
 	Result.StableSort(SubsystemColumnSorter());
 	return Result;
 }
@@ -271,7 +377,7 @@ SubsystemColumnPtr FSubsystemModel::FindTableColumn(const FName& ColumnName) con
 {
 	TArray<SubsystemColumnPtr, TInlineAllocator<8>> Result;
 	Result.Append(PermanentColumns);
-	Result.Append(FSubsystemBrowserModule::Get().GetDynamicColumns());
+	Result.Append(Provider->GetDynamicColumns());
 
 	for (const SubsystemColumnPtr& Column : Result)
 	{
@@ -285,6 +391,9 @@ SubsystemColumnPtr FSubsystemModel::FindTableColumn(const FName& ColumnName) con
 
 void FSubsystemModel::EmptyModel()
 {
+	FSubsystemBrowserTrace::ModifyModelItems(-AllCategories.Num(), -AllSubsystems.Num(), -DescriptorBytes);
+	DescriptorBytes = 0;
+
 	for (const SubsystemTreeItemPtr& Category : AllCategories)
 	{
 		Category->RemoveAllChildren();
@@ -295,12 +404,21 @@ void FSubsystemModel::EmptyModel()
 	AllSubsystemsByCategory.Empty();
 
 	LastSelectedItem.Reset();
+	ChangeSampler.Reset();
+
+	// analyses of subsystems that are still alive survive repopulation
+	for (auto It = RetainedGraphs.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
 }
 
 void FSubsystemModel::PopulateCategories()
 {
-	FSubsystemBrowserModule& BrowserModule = FSubsystemBrowserModule::Get();
-	for (auto& SubsystemCategory : BrowserModule.GetCategories())
+	for (auto& SubsystemCategory : Provider->GetCategories())
 	{
 		auto Category = MakeShared<FSubsystemTreeCategoryItem>(SharedThis(this), SubsystemCategory.ToSharedRef());
 
@@ -323,15 +441,22 @@ void FSubsystemModel::PopulateSubsystems()
 		const FSubsystemTreeCategoryItem* AsCategory = Category->GetAsCategoryDescriptor();
 
 		TArray<UObject*> Result;
-		AsCategory->Data->Select(LocalWorld, Result);
+		{
+			SB_TRACE_SCOPE(FSubsystemCategory::Select);
+			AsCategory->Data->Select(LocalWorld, Result);
+		}
+
 		for (UObject* Impl : Result)
 		{
 			auto Descriptor = MakeShared<FSubsystemTreeSubsystemItem>(SharedThis(this), Category, Impl);
+			DescriptorBytes += Descriptor->GetAllocatedSize();
 
 			AllSubsystems.Add(Descriptor);
 			AllSubsystemsByCategory.FindOrAdd(AsCategory->GetID()).Add(Descriptor);
 		}
 	}
+
+	FSubsystemBrowserTrace::ModifyModelItems(AllCategories.Num(), AllSubsystems.Num(), DescriptorBytes);
 }
 
 #undef LOCTEXT_NAMESPACE
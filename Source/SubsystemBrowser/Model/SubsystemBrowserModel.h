@@ -4,6 +4,10 @@
 
 #include "Model/SubsystemBrowserDescriptor.h"
 #include "Model/SubsystemBrowserColumn.h"
+#include "Model/SubsystemBrowserChangeSampler.h"
+#include "Model/SubsystemBrowserModelContext.h"
+#include "Model/SubsystemBrowserPerfStats.h"
+#include "Model/SubsystemBrowserRetainedGraph.h"
 #include "Misc/TextFilter.h"
 
 /* Subsystem text filter */
@@ -21,6 +25,7 @@ class SubsystemCategoryFilter : public IFilter<const ISubsystemTreeItem&>
 {
 public:
 	SubsystemCategoryFilter();
+	explicit SubsystemCategoryFilter(TSharedRef<ISubsystemModelSettings> InSettings);
 
 	virtual FChangedEvent& OnChanged() override { return OnChangedInternal; }
 	virtual bool PassesFilter(const ISubsystemTreeItem& InItem) const override;
@@ -28,6 +33,7 @@ public:
 	void HideCategory(FSubsystemTreeItemID InCategory);
 	bool IsCategoryVisible(FSubsystemTreeItemID InCategory) const;
 private:
+	TSharedRef<ISubsystemModelSettings> Settings;
 	TMap<FSubsystemTreeItemID, bool>	FilterState;
 	FChangedEvent						OnChangedInternal;
 };
@@ -45,11 +51,20 @@ struct SubsystemCategorySorter
 	}
 };
 
-/* Subsystem list data model */
-class FSubsystemModel : public TSharedFromThis<FSubsystemModel>
+/**
+ * Subsystem list data model.
+ *
+ * Settings and categories are injected, default constructor binds model to browser settings and module registry.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemModel : public TSharedFromThis<FSubsystemModel>
 {
 public:
 	FSubsystemModel();
+	FSubsystemModel(TSharedRef<ISubsystemModelSettings> InSettings, TSharedRef<ISubsystemModelProvider> InProvider);
+	~FSubsystemModel();
+
+	const ISubsystemModelSettings& GetSettings() const { return *Settings; }
+	TSharedRef<ISubsystemModelSettings> GetSettingsRef() const { return Settings; }
 
 	TWeakObjectPtr<UWorld> GetCurrentWorld() const;
 	void SetCurrentWorld(TWeakObjectPtr<UWorld> InWorld);
@@ -67,6 +82,15 @@ public:
 	
 	void GetSubsystemSubobjects(SubsystemTreeItemConstPtr Subsystem, TArray<SubsystemTreeItemPtr>& OutChildren);
 
+	/* start or restart analysis of objects retained by subsystem */
+	void AnalyzeRetainedGraph(SubsystemTreeItemConstPtr Subsystem);
+	/* drop analysis results of subsystem instance */
+	void ClearRetainedGraph(const UObject* InObject);
+	/* find analysis of subsystem instance if one was requested */
+	TSharedPtr<FSubsystemRetainedGraph> FindRetainedGraph(const UObject* InObject) const;
+	/* append node with analysis results to subsystem children if one was requested */
+	void GetSubsystemRetainedGraph(SubsystemTreeItemConstPtr Subsystem, TArray<SubsystemTreeItemPtr>& OutChildren);
+
 	/* get total number of subsystems in category */
 	int32 GetNumSubsystemsFromCategory(SubsystemTreeItemConstPtr Category);
 	/* get total number of subsystems in visible categories */
@@ -84,6 +108,11 @@ public:
 	/* check if dynamic column is enabled by settings */
 	bool ShouldShowColumn(SubsystemColumnPtr Column) const;
 
+	/* collect live instances of config exportable subsystems in current world */
+	void GetConfigExportableSubsystems(TArray<UObject*>& OutObjects) const;
+	/* collect settings objects of all categories */
+	void GetSettingsObjects(TArray<UObject*>& OutObjects) const;
+
 	bool IsItemSelected(TSharedRef<const ISubsystemTreeItem> Item);
 
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnItemSelectionChange, TSharedPtr<ISubsystemTreeItem> /* Item */);
@@ -92,14 +121,29 @@ public:
 
 	void NotifySelected(TSharedPtr<ISubsystemTreeItem> Item);
 
+	/* timings of recent operations performed on this model */
+	FSubsystemPerfStats& GetPerfStats() { return PerfStats; }
+	const FSubsystemPerfStats& GetPerfStats() const { return PerfStats; }
+
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnItemDataChanged, TSharedRef<ISubsystemTreeItem> /* Item */);
 	/* delegate that is triggered when one of subsystems in this model is changed and needs possible update */
 	FOnItemDataChanged OnDataChanged;
 
+	/* sampler detecting changes of reflected state of displayed items */
+	FSubsystemChangeSampler& GetChangeSampler() { return ChangeSampler; }
+	/* run one time-sliced step of change detection and broadcast OnDataChanged for changed items */
+	void TickChangeDetection(uint32 InFrameInterval, double InBudgetSeconds);
+
+	/* delegate that is triggered when nodes were added to or removed from tree outside of filtering */
+	FSimpleMulticastDelegate OnHierarchyChanged;
+	/* delegate that is triggered when results of one of retained references analyses changed */
+	FSimpleMulticastDelegate OnRetainedGraphUpdated;
+
 private:
 	void EmptyModel();
 	void PopulateCategories();
 	void PopulateSubsystems();
+	void HandleRetainedGraphUpdated();
 
 	/* Global list of all categories */
 	TArray<SubsystemTreeItemPtr> AllCategories;
@@ -107,8 +151,20 @@ private:
 	TArray<SubsystemTreeItemPtr> AllSubsystems;
 	/* Global list of all subsystems by category */
 	TMap<FName, TArray<SubsystemTreeItemPtr>> AllSubsystemsByCategory;
+	/* Source of model settings */
+	TSharedRef<ISubsystemModelSettings> Settings;
+	/* Source of categories and dynamic columns */
+	TSharedRef<ISubsystemModelProvider> Provider;
 	/* List of permanent columns */
 	TArray<SubsystemColumnPtr> PermanentColumns;
+	/* Approximate memory used by subsystem descriptors */
+	int64 DescriptorBytes = 0;
+	/* Timings of recent operations */
+	FSubsystemPerfStats PerfStats;
+	/* Live change detection state */
+	FSubsystemChangeSampler ChangeSampler;
+	/* Retained references analyses by subsystem instance */
+	TMap<TWeakObjectPtr<const UObject>, TSharedRef<FSubsystemRetainedGraph>> RetainedGraphs;
 
 	/* Pointer to currently browsing world */
 	TWeakObjectPtr<UWorld> CurrentWorld;
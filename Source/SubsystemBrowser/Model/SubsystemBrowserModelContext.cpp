@@ -0,0 +1,99 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserModelContext.h"
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserSettings.h"
+
+bool FSubsystemModelSettings_Browser::ShouldShowOnlyGame() const
+{
+	return USubsystemBrowserSettings::Get()->ShouldShowOnlyGame();
+}
+
+bool FSubsystemModelSettings_Browser::ShouldShowOnlyPlugins() const
+{
+	return USubsystemBrowserSettings::Get()->ShouldShowOnlyPlugins();
+}
+
+bool FSubsystemModelSettings_Browser::ShouldShowOnlyViewable() const
+{
+	return USubsystemBrowserSettings::Get()->ShouldShowOnlyViewable();
+}
+
+bool FSubsystemModelSettings_Browser::ShouldHideEmptyCategories() const
+{
+	return USubsystemBrowserSettings::Get()->ShouldHideEmptyCategories();
+}
+
+bool FSubsystemModelSettings_Browser::ShouldShowSubobjects() const
+{
+	return USubsystemBrowserSettings::Get()->ShouldShowSubobjbects();
+}
+
+bool FSubsystemModelSettings_Browser::HasIgnoredSubsystems() const
+{
+	return USubsystemBrowserSettings::Get()->HasIgnoredSubsystems();
+}
+
+bool FSubsystemModelSettings_Browser::IsSubsystemIgnored(const FString& InScriptName) const
+{
+	return USubsystemBrowserSettings::Get()->IsSubsystemIgnored(InScriptName);
+}
+
+bool FSubsystemModelSettings_Browser::GetTableColumnState(FName InColumn) const
+{
+	return USubsystemBrowserSettings::Get()->GetTableColumnState(InColumn);
+}
+
+void FSubsystemModelSettings_Browser::LoadCategoryStates(TMap<FName, bool>& OutStates)
+{
+	USubsystemBrowserSettings::Get()->LoadCategoryStates(OutStates);
+}
+
+void FSubsystemModelSettings_Browser::SetCategoryState(FName InCategory, bool bInState)
+{
+	USubsystemBrowserSettings::Get()->SetCategoryState(InCategory, bInState);
+}
+
+int32 FSubsystemModelSettings_Browser::GetMaxQuickActionsToShow() const
+{
+	return USubsystemBrowserSettings::Get()->GetMaxQuickActionsToShow();
+}
+
+bool FSubsystemModelSettings_Browser::ShouldDisplayConfigExportActions() const
+{
+	return USubsystemBrowserSettings::Get()->ShouldDisplayConfigExportActions();
+}
+
+void FSubsystemModelSettings_Browser::AddToIgnoreList(const FString& InClass, bool bMatchSubstring)
+{
+	USubsystemBrowserSettings::Get()->AddToIgnoreList(InClass, bMatchSubstring);
+}
+
+TSharedRef<ISubsystemModelSettings> FSubsystemModelSettings_Browser::Get()
+{
+	// adapter is stateless so a single instance is shared by all models
+	static TSharedRef<ISubsystemModelSettings> Instance = MakeShared<FSubsystemModelSettings_Browser>();
+	return Instance;
+}
+
+const TArray<SubsystemCategoryPtr>& FSubsystemModelProvider_Browser::GetCategories() const
+{
+	return FSubsystemBrowserModule::Get().GetCategories();
+}
+
+const TArray<SubsystemColumnPtr>& FSubsystemModelProvider_Browser::GetDynamicColumns() const
+{
+	return FSubsystemBrowserModule::Get().GetDynamicColumns();
+}
+
+void FSubsystemModelProvider_Browser::GetPermanentColumns(TArray<SubsystemColumnPtr>& OutColumns) const
+{
+	FSubsystemBrowserModule::AddPermanentColumns(OutColumns);
+}
+
+TSharedRef<ISubsystemModelProvider> FSubsystemModelProvider_Browser::Get()
+{
+	static TSharedRef<ISubsystemModelProvider> Instance = MakeShared<FSubsystemModelProvider_Browser>();
+	return Instance;
+}
@@ -0,0 +1,91 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Model/SubsystemBrowserCategory.h"
+
+struct FSubsystemDynamicColumn;
+
+/**
+ * Browser settings consumed by subsystem model and descriptors.
+ *
+ * Model never reads settings object directly so it can be driven by any implementation,
+ * like an in-memory one in automation tests.
+ *
+ * Model, descriptors, filtering and sorting form the core layer that only depends on these interfaces.
+ * Descriptor icon, tooltip and context menu hooks and dynamic columns are view adapters: they are
+ * called by browser widgets only and still use Slate types and browser settings appearance options.
+ */
+struct SUBSYSTEMBROWSER_API ISubsystemModelSettings
+{
+	virtual ~ISubsystemModelSettings() = default;
+
+	virtual bool ShouldShowOnlyGame() const = 0;
+	virtual bool ShouldShowOnlyPlugins() const = 0;
+	virtual bool ShouldShowOnlyViewable() const = 0;
+	virtual bool ShouldHideEmptyCategories() const = 0;
+	virtual bool ShouldShowSubobjects() const = 0;
+
+	virtual bool HasIgnoredSubsystems() const = 0;
+	virtual bool IsSubsystemIgnored(const FString& InScriptName) const = 0;
+
+	/* dynamic column visibility */
+	virtual bool GetTableColumnState(FName InColumn) const = 0;
+
+	/* category filter persistence */
+	virtual void LoadCategoryStates(TMap<FName, bool>& OutStates) = 0;
+	virtual void SetCategoryState(FName InCategory, bool bInState) = 0;
+
+	/* descriptor actions */
+	virtual int32 GetMaxQuickActionsToShow() const = 0;
+	virtual bool ShouldDisplayConfigExportActions() const = 0;
+	virtual void AddToIgnoreList(const FString& InClass, bool bMatchSubstring) = 0;
+};
+
+/**
+ * Source of categories and columns displayed by subsystem model.
+ */
+struct SUBSYSTEMBROWSER_API ISubsystemModelProvider
+{
+	virtual ~ISubsystemModelProvider() = default;
+
+	virtual const TArray<SubsystemCategoryPtr>& GetCategories() const = 0;
+	virtual const TArray<TSharedPtr<FSubsystemDynamicColumn>>& GetDynamicColumns() const = 0;
+	/* columns that are always visible */
+	virtual void GetPermanentColumns(TArray<TSharedPtr<FSubsystemDynamicColumn>>& OutColumns) const = 0;
+};
+
+/**
+ * Model settings backed by USubsystemBrowserSettings
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemModelSettings_Browser : public ISubsystemModelSettings
+{
+	virtual bool ShouldShowOnlyGame() const override;
+	virtual bool ShouldShowOnlyPlugins() const override;
+	virtual bool ShouldShowOnlyViewable() const override;
+	virtual bool ShouldHideEmptyCategories() const override;
+	virtual bool ShouldShowSubobjects() const override;
+	virtual bool HasIgnoredSubsystems() const override;
+	virtual bool IsSubsystemIgnored(const FString& InScriptName) const override;
+	virtual bool GetTableColumnState(FName InColumn) const override;
+	virtual void LoadCategoryStates(TMap<FName, bool>& OutStates) override;
+	virtual void SetCategoryState(FName InCategory, bool bInState) override;
+	virtual int32 GetMaxQuickActionsToShow() const override;
+	virtual bool ShouldDisplayConfigExportActions() const override;
+	virtual void AddToIgnoreList(const FString& InClass, bool bMatchSubstring) override;
+
+	static TSharedRef<ISubsystemModelSettings> Get();
+};
+
+/**
+ * Model provider backed by categories and columns registered in FSubsystemBrowserModule
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemModelProvider_Browser : public ISubsystemModelProvider
+{
+	virtual const TArray<SubsystemCategoryPtr>& GetCategories() const override;
+	virtual const TArray<TSharedPtr<FSubsystemDynamicColumn>>& GetDynamicColumns() const override;
+	virtual void GetPermanentColumns(TArray<TSharedPtr<FSubsystemDynamicColumn>>& OutColumns) const override;
+
+	static TSharedRef<ISubsystemModelProvider> Get();
+};
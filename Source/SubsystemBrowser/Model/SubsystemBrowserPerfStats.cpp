@@ -0,0 +1,175 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserPerfStats.h"
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace SubsystemPerfStats
+{
+	/* All live stat instances, accessed on game thread only */
+	static TArray<FSubsystemPerfStats*>& GetInstances()
+	{
+		static TArray<FSubsystemPerfStats*> Instances;
+		return Instances;
+	}
+
+	static void HandleStatsCommand(const TArray<FString>& Args)
+	{
+		if (Args.Num() && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+		{
+			FSubsystemPerfStats::ForEachInstance([](FSubsystemPerfStats& Stats) { Stats.Reset(); });
+			FSubsystemBrowserTrace::ResetCacheStats();
+			UE_LOG(LogSubsystemBrowser, Display, TEXT("Subsystem browser stats reset"));
+			return;
+		}
+
+		FSubsystemPerfStats::ForEachInstance([](FSubsystemPerfStats& Stats)
+		{
+			UE_LOG(LogSubsystemBrowser, Display, TEXT("%s"), *Stats.ToString());
+		});
+
+		UE_LOG(LogSubsystemBrowser, Display, TEXT("Cache hit ratio: details views %.0f%%, settings widgets %.0f%%"),
+			FSubsystemBrowserTrace::GetCacheHitRatio(FSubsystemBrowserTrace::ECache::DetailsPool) * 100.f,
+			FSubsystemBrowserTrace::GetCacheHitRatio(FSubsystemBrowserTrace::ECache::SettingsWidget) * 100.f);
+	}
+
+	static FAutoConsoleCommand StatsCommand(
+		TEXT("SubsystemBrowser.Stats"),
+		TEXT("Print timings of recent subsystem browser operations. Use 'SubsystemBrowser.Stats reset' to clear them."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleStatsCommand)
+	);
+}
+
+FSubsystemPerfStats::FScope::FScope(FSubsystemPerfStats& InStats, ESubsystemPerfMetric InMetric)
+	: Stats(InStats), Metric(InMetric), StartTime(FPlatformTime::Seconds())
+{
+}
+
+FSubsystemPerfStats::FScope::~FScope()
+{
+	Stats.Record(Metric, FPlatformTime::Seconds() - StartTime, NumItems);
+}
+
+FSubsystemPerfStats::FSubsystemPerfStats(const TCHAR* InName)
+	: Name(InName)
+{
+	SubsystemPerfStats::GetInstances().Add(this);
+}
+
+FSubsystemPerfStats::~FSubsystemPerfStats()
+{
+	SubsystemPerfStats::GetInstances().RemoveSingleSwap(this);
+}
+
+void FSubsystemPerfStats::Record(ESubsystemPerfMetric InMetric, double InSeconds, int32 InNumItems)
+{
+	check(InMetric < ESubsystemPerfMetric::Num);
+
+	FHistory& Entry = History[(int32)InMetric];
+	Entry.Samples[Entry.Head].Seconds = InSeconds;
+	Entry.Samples[Entry.Head].NumItems = InNumItems;
+	Entry.Head = (Entry.Head + 1) % HistorySize;
+	Entry.Num = FMath::Min(Entry.Num + 1, HistorySize);
+}
+
+void FSubsystemPerfStats::Reset()
+{
+	for (FHistory& Entry : History)
+	{
+		Entry.Head = 0;
+		Entry.Num = 0;
+	}
+}
+
+bool FSubsystemPerfStats::GetLastSample(ESubsystemPerfMetric InMetric, FSample& OutSample) const
+{
+	check(InMetric < ESubsystemPerfMetric::Num);
+
+	const FHistory& Entry = History[(int32)InMetric];
+	if (!Entry.Num)
+	{
+		return false;
+	}
+
+	OutSample = Entry.Samples[(Entry.Head + HistorySize - 1) % HistorySize];
+	return true;
+}
+
+bool FSubsystemPerfStats::GetSummary(ESubsystemPerfMetric InMetric, double& OutAverageSeconds, double& OutMaxSeconds) const
+{
+	check(InMetric < ESubsystemPerfMetric::Num);
+
+	const FHistory& Entry = History[(int32)InMetric];
+	if (!Entry.Num)
+	{
+		return false;
+	}
+
+	// samples are stored from slot 0 until buffer wraps, after that every slot is in use
+	double Total = 0.0;
+	OutMaxSeconds = 0.0;
+	for (int32 Idx = 0; Idx < Entry.Num; ++Idx)
+	{
+		Total += Entry.Samples[Idx].Seconds;
+		OutMaxSeconds = FMath::Max(OutMaxSeconds, Entry.Samples[Idx].Seconds);
+	}
+	OutAverageSeconds = Total / Entry.Num;
+	return true;
+}
+
+int32 FSubsystemPerfStats::GetNumSamples(ESubsystemPerfMetric InMetric) const
+{
+	check(InMetric < ESubsystemPerfMetric::Num);
+	return History[(int32)InMetric].Num;
+}
+
+FString FSubsystemPerfStats::ToString() const
+{
+	FString Result = FString::Printf(TEXT("Subsystem browser stats [%s]"), *Name);
+
+	for (int32 Idx = 0; Idx < (int32)ESubsystemPerfMetric::Num; ++Idx)
+	{
+		const ESubsystemPerfMetric Metric = (ESubsystemPerfMetric)Idx;
+
+		FSample Last;
+		double Average = 0.0, Max = 0.0;
+		if (GetLastSample(Metric, Last) && GetSummary(Metric, Average, Max))
+		{
+			Result += FString::Printf(TEXT("\n  %-18s last %8.3f ms (%d items)  avg %8.3f ms  max %8.3f ms  samples %d"),
+				GetMetricName(Metric), Last.Seconds * 1000.0, Last.NumItems, Average * 1000.0, Max * 1000.0, GetNumSamples(Metric));
+		}
+	}
+
+	return Result;
+}
+
+const TCHAR* FSubsystemPerfStats::GetMetricName(ESubsystemPerfMetric InMetric)
+{
+	switch (InMetric)
+	{
+	case ESubsystemPerfMetric::Populate: return TEXT("Populate");
+	case ESubsystemPerfMetric::Filter: return TEXT("Filter");
+	case ESubsystemPerfMetric::Sort: return TEXT("Sort");
+	case ESubsystemPerfMetric::DetailsRefresh: return TEXT("DetailsRefresh");
+	case ESubsystemPerfMetric::SettingsDiscovery: return TEXT("SettingsDiscovery");
+	case ESubsystemPerfMetric::SnapshotCapture: return TEXT("SnapshotCapture");
+	default: return TEXT("Unknown");
+	}
+}
+
+FSubsystemPerfStats& FSubsystemPerfStats::GetShared()
+{
+	static FSubsystemPerfStats SharedStats(TEXT("Shared"));
+	return SharedStats;
+}
+
+void FSubsystemPerfStats::ForEachInstance(TFunctionRef<void(FSubsystemPerfStats&)> InFunc)
+{
+	for (FSubsystemPerfStats* Stats : SubsystemPerfStats::GetInstances())
+	{
+		InFunc(*Stats);
+	}
+}
@@ -0,0 +1,100 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreFwd.h"
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "Templates/Function.h"
+
+/**
+ * Operations that are timed by browser
+ */
+enum class ESubsystemPerfMetric : uint8
+{
+	Populate,
+	Filter,
+	Sort,
+	DetailsRefresh,
+	SettingsDiscovery,
+	SnapshotCapture,
+	Num
+};
+
+/**
+ * Keeps timings of recent browser operations in a fixed size ring buffer per operation.
+ *
+ * Every instance is registered globally so SubsystemBrowser.Stats console command can report or reset it.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemPerfStats
+{
+public:
+	/* Number of samples retained per operation */
+	static constexpr int32 HistorySize = 32;
+
+	struct FSample
+	{
+		/* operation duration */
+		double Seconds = 0.0;
+		/* number of items processed by operation */
+		int32 NumItems = 0;
+	};
+
+	/* Scope that records its duration into stats on destruction */
+	class SUBSYSTEMBROWSER_API FScope
+	{
+	public:
+		FScope(FSubsystemPerfStats& InStats, ESubsystemPerfMetric InMetric);
+		~FScope();
+
+		void SetNumItems(int32 InNumItems) { NumItems = InNumItems; }
+	private:
+		FSubsystemPerfStats& Stats;
+		ESubsystemPerfMetric Metric;
+		double StartTime;
+		int32 NumItems = 0;
+	};
+
+	explicit FSubsystemPerfStats(const TCHAR* InName);
+	~FSubsystemPerfStats();
+
+	FSubsystemPerfStats(const FSubsystemPerfStats&) = delete;
+	FSubsystemPerfStats& operator=(const FSubsystemPerfStats&) = delete;
+
+	/* Add a new sample, overwriting the oldest one when buffer is full */
+	void Record(ESubsystemPerfMetric InMetric, double InSeconds, int32 InNumItems = 0);
+	/* Remove all recorded samples */
+	void Reset();
+
+	/* Get most recent sample of operation, if any recorded */
+	bool GetLastSample(ESubsystemPerfMetric InMetric, FSample& OutSample) const;
+	/* Get average and maximum duration over retained samples */
+	bool GetSummary(ESubsystemPerfMetric InMetric, double& OutAverageSeconds, double& OutMaxSeconds) const;
+	/* Get number of retained samples */
+	int32 GetNumSamples(ESubsystemPerfMetric InMetric) const;
+
+	const FString& GetName() const { return Name; }
+
+	/* Multiline description of all retained samples */
+	FString ToString() const;
+
+	static const TCHAR* GetMetricName(ESubsystemPerfMetric InMetric);
+
+	/* Stats for operations that are not bound to a browser panel, like settings discovery */
+	static FSubsystemPerfStats& GetShared();
+
+	/* Iterate over all live instances */
+	static void ForEachInstance(TFunctionRef<void(FSubsystemPerfStats&)> InFunc);
+
+private:
+	struct FHistory
+	{
+		FSample Samples[HistorySize];
+		/* index of next slot to write */
+		int32 Head = 0;
+		int32 Num = 0;
+	};
+
+	FString Name;
+	FHistory History[(int32)ESubsystemPerfMetric::Num];
+};
@@ -0,0 +1,724 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserProfileImport.h"
+
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Misc/CString.h"
+#include "Misc/Paths.h"
+#include "Templates/UniquePtr.h"
+#if SB_WITH_TRACE_IMPORT
+#include "Trace/Analysis.h"
+#include "Trace/Analyzer.h"
+#include "Trace/DataStream.h"
+#endif
+
+namespace SubsystemProfileImport
+{
+	/* size of a single read from capture file */
+	static constexpr int64 ChunkSize = 1024 * 1024;
+	/* lines longer than this are skipped instead of being accumulated */
+	static constexpr int32 MaxLineBytes = 16 * 1024 * 1024;
+	/* scope names remembered with their match result, beyond that names are matched every time */
+	static constexpr int32 MaxResolvedNames = 65536;
+
+	/* milliseconds per unit of time values */
+	static constexpr double MsPerSecond = 1000.0;
+	static constexpr double MsPerMillisecond = 1.0;
+
+	/* split single CSV line respecting quoted fields */
+	static void SplitLine(const FString& InLine, TArray<FString>& OutFields)
+	{
+		OutFields.Reset();
+
+		FString Field;
+		bool bQuoted = false;
+		for (int32 Idx = 0; Idx < InLine.Len(); ++Idx)
+		{
+			const TCHAR Char = InLine[Idx];
+			if (Char == TEXT('"'))
+			{
+				if (bQuoted && Idx + 1 < InLine.Len() && InLine[Idx + 1] == TEXT('"'))
+				{
+					Field.AppendChar(Char);
+					++Idx;
+				}
+				else
+				{
+					bQuoted = !bQuoted;
+				}
+			}
+			else if (Char == TEXT(',') && !bQuoted)
+			{
+				OutFields.Add(MoveTemp(Field));
+				Field.Reset();
+			}
+			else
+			{
+				Field.AppendChar(Char);
+			}
+		}
+		OutFields.Add(MoveTemp(Field));
+	}
+
+	/* milliseconds per unit with given name, default when unit is not recognized */
+	static double GetMsPerUnit(const FString& InUnit, double InDefault)
+	{
+		if (InUnit.Equals(TEXT("s"), ESearchCase::IgnoreCase) || InUnit.Equals(TEXT("sec"), ESearchCase::IgnoreCase))
+			return 1000.0;
+		if (InUnit.Equals(TEXT("ms"), ESearchCase::IgnoreCase))
+			return 1.0;
+		if (InUnit.Equals(TEXT("us"), ESearchCase::IgnoreCase) || InUnit.Equals(TEXT("\u00B5s")) || InUnit.Equals(TEXT("\u03BCs")))
+			return 0.001;
+		if (InUnit.Equals(TEXT("ns"), ESearchCase::IgnoreCase))
+			return 0.000001;
+		return InDefault;
+	}
+
+	/* split "Incl (ms)" or "Incl [ms]" header into name and unit */
+	static void SplitHeaderUnit(const FString& InColumn, FString& OutName, FString& OutUnit)
+	{
+		OutName = InColumn.TrimStartAndEnd();
+		OutUnit.Reset();
+
+		int32 Open = INDEX_NONE;
+		if (OutName.EndsWith(TEXT(")")))
+		{
+			OutName.FindLastChar(TEXT('('), Open);
+		}
+		else if (OutName.EndsWith(TEXT("]")))
+		{
+			OutName.FindLastChar(TEXT('['), Open);
+		}
+
+		if (Open != INDEX_NONE)
+		{
+			OutUnit = OutName.Mid(Open + 1, OutName.Len() - Open - 2).TrimStartAndEnd();
+			OutName = OutName.Left(Open).TrimEnd();
+		}
+	}
+
+	static int32 FindColumn(const TArray<FString>& InHeader, std::initializer_list<const TCHAR*> InNames, FString* OutUnit = nullptr)
+	{
+		FString Name, Unit;
+		for (const TCHAR* Candidate : InNames)
+		{
+			for (int32 Index = 0; Index < InHeader.Num(); ++Index)
+			{
+				SplitHeaderUnit(InHeader[Index], Name, Unit);
+				if (Name.Equals(Candidate, ESearchCase::IgnoreCase))
+				{
+					if (OutUnit)
+					{
+						*OutUnit = Unit;
+					}
+					return Index;
+				}
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	/* find column with time values, unit in header overrides default unit of column */
+	static int32 FindTimeColumn(const TArray<FString>& InHeader, std::initializer_list<const TCHAR*> InNames, double InDefaultMsPerUnit, double& OutMsPerUnit)
+	{
+		FString Unit;
+		const int32 Index = FindColumn(InHeader, InNames, &Unit);
+		OutMsPerUnit = GetMsPerUnit(Unit, InDefaultMsPerUnit);
+		return Index;
+	}
+
+	/* parse time value in milliseconds, unit written after number overrides unit of column */
+	static double ParseMs(const FString& InField, double InMsPerUnit)
+	{
+		const FString Field = InField.TrimStartAndEnd();
+
+		int32 UnitStart = 0;
+		while (UnitStart < Field.Len() && (FChar::IsDigit(Field[UnitStart]) || Field[UnitStart] == TEXT('.') || Field[UnitStart] == TEXT('-')
+			|| Field[UnitStart] == TEXT('+') || ((Field[UnitStart] == TEXT('e') || Field[UnitStart] == TEXT('E')) && UnitStart > 0 && FChar::IsDigit(Field[UnitStart - 1]))))
+		{
+			++UnitStart;
+		}
+
+		const double Value = FCString::Atod(*Field);
+		return Value * GetMsPerUnit(Field.Mid(UnitStart).TrimStart(), InMsPerUnit);
+	}
+}
+
+struct FSubsystemProfileImport::FJob
+{
+	FString FilePath;
+	TMap<FString, FName> ClassNames;
+	int64 TotalBytes = 0;
+	bool bTraceFile = false;
+
+	FThreadSafeCounter64 BytesRead;
+	FThreadSafeBool bCancelled;
+	FThreadSafeBool bDone;
+
+	/* valid only once bDone is set */
+	bool bSuccess = false;
+	bool bHasCallCounts = false;
+	TMap<FName, FSubsystemProfileTiming> Results;
+
+	void Run()
+	{
+		bSuccess = (bTraceFile ? ReadTrace() : Read() && bHeaderParsed) && !bCancelled;
+		bDone = true;
+	}
+
+private:
+#if SB_WITH_TRACE_IMPORT
+	/**
+	 * Trace file source that reports read progress and ends stream once import is cancelled
+	 */
+	class FTraceStream : public UE::Trace::IInDataStream
+	{
+	public:
+		FTraceStream(IFileHandle& InHandle, FJob& InJob) : Handle(InHandle), Job(InJob) { }
+
+		virtual int32 Read(void* Data, uint32 Size) override
+		{
+			const int64 ToRead = FMath::Min<int64>(Size, Handle.Size() - Handle.Tell());
+			if (Job.bCancelled || ToRead <= 0 || !Handle.Read(static_cast<uint8*>(Data), ToRead))
+			{
+				return 0;
+			}
+
+			Job.BytesRead.Add(ToRead);
+			return (int32)ToRead;
+		}
+
+	private:
+		IFileHandle& Handle;
+		FJob& Job;
+	};
+
+	/**
+	 * Aggregates CpuProfiler scopes of every thread as they are decoded, nothing of the session is kept.
+	 * GPU timings are traced by other loggers and are not subscribed to.
+	 */
+	class FCpuProfilerAnalyzer : public UE::Trace::IAnalyzer
+	{
+	public:
+		explicit FCpuProfilerAnalyzer(FJob& InJob) : Job(InJob) { }
+
+		virtual void OnAnalysisBegin(const FOnAnalysisContext& Context) override
+		{
+			FInterfaceBuilder& Builder = Context.InterfaceBuilder;
+			Builder.RouteEvent(RouteId_EventSpec, "CpuProfiler", "EventSpec");
+			Builder.RouteEvent(RouteId_EventBatch, "CpuProfiler", "EventBatch");
+			Builder.RouteEvent(RouteId_EndCapture, "CpuProfiler", "EndCapture");
+			Builder.RouteEvent(RouteId_EventBatchV2, "CpuProfiler", "EventBatchV2");
+			Builder.RouteEvent(RouteId_EndCaptureV2, "CpuProfiler", "EndCaptureV2");
+		}
+
+		virtual bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override
+		{
+			const FEventData& EventData = Context.EventData;
+			switch (RouteId)
+			{
+			case RouteId_EventSpec:
+			{
+				// specs are few compared to their events, so names are matched once per spec
+				FString Name;
+				EventData.GetString("Name", Name);
+				SpecKeys.Add(EventData.GetValue<uint32>("Id"), Job.ResolveName(Name));
+				break;
+			}
+			case RouteId_EventBatch:
+			case RouteId_EndCapture:
+				ProcessBuffer(Context, EventData.GetArrayView<uint8>("Data"), false);
+				break;
+			case RouteId_EventBatchV2:
+			case RouteId_EndCaptureV2:
+				ProcessBuffer(Context, EventData.GetArrayView<uint8>("Data"), true);
+				break;
+			}
+			return true;
+		}
+
+	private:
+		enum : uint16
+		{
+			RouteId_EventSpec,
+			RouteId_EventBatch,
+			RouteId_EndCapture,
+			RouteId_EventBatchV2,
+			RouteId_EndCaptureV2,
+		};
+
+		struct FOpenScope
+		{
+			FName Key;
+			uint64 StartCycle = 0;
+			bool bCounted = false;
+		};
+
+		struct FThreadState
+		{
+			uint64 LastCycle = 0;
+			TArray<FOpenScope> Stack;
+			TMap<FName, int32> NumOpen;
+		};
+
+		static uint64 Decode7bit(const uint8*& InOutPtr)
+		{
+			uint64 Value = 0;
+			uint32 Shift = 0;
+			uint8 Byte;
+			do
+			{
+				Byte = *InOutPtr++;
+				Value |= uint64(Byte & 0x7F) << Shift;
+				Shift += 7;
+			}
+			while (Byte & 0x80);
+			return Value;
+		}
+
+		/*
+		 * Buffers hold 7-bit encoded cycle deltas followed by spec id for scope enter.
+		 * First version flags enter in lowest bit, second one flags enter in second bit and metadata in lowest.
+		 * Scopes with metadata refer to metadata id instead of spec and are not matched.
+		 */
+		void ProcessBuffer(const FOnEventContext& Context, TArrayView<const uint8> InData, bool bVersion2)
+		{
+			FThreadState& Thread = Threads.FindOrAdd(Context.ThreadInfo.GetId());
+
+			const uint8* Ptr = InData.GetData();
+			const uint8* const End = Ptr + InData.Num();
+			while (Ptr < End)
+			{
+				const uint64 Value = Decode7bit(Ptr);
+				const uint64 Cycle = Thread.LastCycle + (Value >> (bVersion2 ? 2 : 1));
+				Thread.LastCycle = Cycle;
+
+				const bool bIsEnter = bVersion2 ? (Value & 2) != 0 : (Value & 1) != 0;
+				if (bIsEnter)
+				{
+					const uint32 Id = (uint32)Decode7bit(Ptr);
+					const FName* Key = (bVersion2 && (Value & 1)) ? nullptr : SpecKeys.Find(Id);
+
+					// only outermost scope of a class is counted, nested ones are part of its inclusive time already
+					FOpenScope& Scope = Thread.Stack.AddDefaulted_GetRef();
+					Scope.Key = Key ? *Key : NAME_None;
+					Scope.StartCycle = Cycle;
+					Scope.bCounted = !Scope.Key.IsNone() && Thread.NumOpen.FindOrAdd(Scope.Key)++ == 0;
+				}
+				else if (Thread.Stack.Num())
+				{
+					const FOpenScope Scope = Thread.Stack.Pop(false);
+					if (!Scope.Key.IsNone() && --Thread.NumOpen.FindChecked(Scope.Key) == 0 && Scope.bCounted)
+					{
+						FSubsystemProfileTiming& Timing = Job.Results.FindOrAdd(Scope.Key);
+						Timing.TotalMs += (Context.EventTime.AsSeconds(Cycle) - Context.EventTime.AsSeconds(Scope.StartCycle)) * SubsystemProfileImport::MsPerSecond;
+						Timing.Calls++;
+					}
+				}
+			}
+		}
+
+		FJob& Job;
+		TMap<uint32, FName> SpecKeys;
+		TMap<uint32, FThreadState> Threads;
+	};
+#endif
+
+	bool ReadTrace()
+	{
+#if SB_WITH_TRACE_IMPORT
+		TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+		if (!Handle.IsValid())
+		{
+			return false;
+		}
+
+		FTraceStream Stream(*Handle, *this);
+		FCpuProfilerAnalyzer Analyzer(*this);
+
+		// analysis runs on its own thread, events are routed to analyzer there while this one waits
+		UE::Trace::FAnalysisContext Context;
+		Context.AddAnalyzer(Analyzer);
+		UE::Trace::FAnalysisProcessor Processor = Context.Process(Stream);
+		Processor.Wait();
+
+		bHasCallCounts = true;
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	bool Read()
+	{
+		TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+		if (!Handle.IsValid())
+		{
+			return false;
+		}
+
+		TArray<uint8> Chunk;
+		Chunk.SetNumUninitialized(SubsystemProfileImport::ChunkSize);
+
+		int64 Remaining = Handle->Size();
+		while (Remaining > 0 && !bCancelled)
+		{
+			const int64 ToRead = FMath::Min(SubsystemProfileImport::ChunkSize, Remaining);
+			if (!Handle->Read(Chunk.GetData(), ToRead))
+			{
+				return false;
+			}
+
+			Remaining -= ToRead;
+			BytesRead.Set(TotalBytes - Remaining);
+
+			int64 LineStart = 0;
+			for (int64 Idx = 0; Idx < ToRead; ++Idx)
+			{
+				if (Chunk[Idx] == '\n')
+				{
+					AppendLine(Chunk.GetData() + LineStart, Idx - LineStart);
+					FlushLine();
+					LineStart = Idx + 1;
+				}
+			}
+			AppendLine(Chunk.GetData() + LineStart, ToRead - LineStart);
+		}
+
+		FlushLine();
+		return true;
+	}
+
+	void AppendLine(const uint8* InData, int64 InNum)
+	{
+		if (bLineTooLong || LineBytes.Num() + InNum > SubsystemProfileImport::MaxLineBytes)
+		{
+			bLineTooLong = true;
+			return;
+		}
+		LineBytes.Append(InData, (int32)InNum);
+	}
+
+	void FlushLine()
+	{
+		if (!bLineTooLong && LineBytes.Num())
+		{
+			int32 Start = 0;
+			if (!bHeaderParsed && LineBytes.Num() >= 3 && LineBytes[0] == 0xEF && LineBytes[1] == 0xBB && LineBytes[2] == 0xBF)
+			{
+				Start = 3;
+			}
+
+			int32 Num = LineBytes.Num() - Start;
+			if (Num > 0 && LineBytes.Last() == '\r')
+			{
+				Num--;
+			}
+
+			FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(LineBytes.GetData() + Start), Num);
+			ProcessLine(FString(Converter.Length(), Converter.Get()));
+		}
+
+		LineBytes.Reset();
+		bLineTooLong = false;
+	}
+
+	void ProcessLine(const FString& InLine)
+	{
+		if (InLine.IsEmpty())
+			return;
+
+		if (!bHeaderParsed)
+		{
+			ParseHeader(InLine);
+			return;
+		}
+
+		// csvprofile repeats header and appends metadata at the end of file
+		if (InLine == HeaderLine || InLine.StartsWith(TEXT("[")))
+			return;
+
+		SubsystemProfileImport::SplitLine(InLine, Fields);
+
+		if (NameColumn != INDEX_NONE)
+		{
+			ProcessEventRow();
+		}
+		else
+		{
+			ProcessFrameRow();
+		}
+	}
+
+	void ParseHeader(const FString& InLine)
+	{
+		using namespace SubsystemProfileImport;
+
+		bHeaderParsed = true;
+		HeaderLine = InLine;
+		SplitLine(InLine, Fields);
+
+		NameColumn = FindColumn(Fields, { TEXT("TimerName"), TEXT("Name"), TEXT("Timer") });
+		if (NameColumn != INDEX_NONE)
+		{
+			// timing events are exported in seconds, timer aggregates in milliseconds they are displayed with
+			DurationColumn = FindTimeColumn(Fields, { TEXT("Duration") }, MsPerSecond, DurationMsPerUnit);
+			if (DurationColumn == INDEX_NONE)
+			{
+				DurationColumn = FindTimeColumn(Fields, { TEXT("Incl"), TEXT("Inclusive"), TEXT("Total Inclusive Time") }, MsPerMillisecond, DurationMsPerUnit);
+			}
+			StartColumn = FindTimeColumn(Fields, { TEXT("StartTime") }, MsPerSecond, StartMsPerUnit);
+			EndColumn = FindTimeColumn(Fields, { TEXT("EndTime") }, MsPerSecond, EndMsPerUnit);
+			CountColumn = FindColumn(Fields, { TEXT("Count"), TEXT("Instance Count") });
+			ThreadColumn = FindColumn(Fields, { TEXT("ThreadId"), TEXT("Thread"), TEXT("ThreadName") });
+			bHasCallCounts = true;
+			return;
+		}
+
+		// exclusive times duplicate inclusive ones and would be counted twice
+		FrameColumnKeys.SetNum(Fields.Num());
+		for (int32 Idx = 0; Idx < Fields.Num(); ++Idx)
+		{
+			FrameColumnKeys[Idx] = Fields[Idx].StartsWith(TEXT("Exclusive/")) ? NAME_None : ResolveName(Fields[Idx]);
+		}
+	}
+
+	void ProcessEventRow()
+	{
+		if (!Fields.IsValidIndex(NameColumn))
+			return;
+
+		const FName Key = ResolveName(Fields[NameColumn]);
+		if (Key.IsNone())
+			return;
+
+		using namespace SubsystemProfileImport;
+
+		double Ms = 0.0;
+		if (Fields.IsValidIndex(StartColumn) && Fields.IsValidIndex(EndColumn))
+		{
+			const double StartMs = ParseMs(Fields[StartColumn], StartMsPerUnit);
+			const double EndMs = ParseMs(Fields[EndColumn], EndMsPerUnit);
+
+			// events of a thread are exported in start order, scope of same class that starts before
+			// counted one ends is nested in it and already part of its time, same as with trace files
+			const FString& Thread = Fields.IsValidIndex(ThreadColumn) ? Fields[ThreadColumn] : FString();
+			double& CountedEndMs = CountedEndTimes.FindOrAdd(MakeTuple(Thread, Key), TNumericLimits<double>::Lowest());
+			if (StartMs < CountedEndMs)
+				return;
+
+			CountedEndMs = EndMs;
+			Ms = Fields.IsValidIndex(DurationColumn) ? ParseMs(Fields[DurationColumn], DurationMsPerUnit) : EndMs - StartMs;
+		}
+		else if (Fields.IsValidIndex(DurationColumn))
+		{
+			Ms = ParseMs(Fields[DurationColumn], DurationMsPerUnit);
+		}
+
+		FSubsystemProfileTiming& Timing = Results.FindOrAdd(Key);
+		Timing.TotalMs += Ms;
+		Timing.Calls += Fields.IsValidIndex(CountColumn) ? FCString::Atoi64(*Fields[CountColumn]) : 1;
+	}
+
+	void ProcessFrameRow()
+	{
+		const int32 Num = FMath::Min(Fields.Num(), FrameColumnKeys.Num());
+		for (int32 Idx = 0; Idx < Num; ++Idx)
+		{
+			if (FrameColumnKeys[Idx].IsNone())
+				continue;
+
+			const double Value = FCString::Atod(*Fields[Idx]);
+			if (Value > 0.0)
+			{
+				FSubsystemProfileTiming& Timing = Results.FindOrAdd(FrameColumnKeys[Idx]);
+				Timing.TotalMs += Value;
+				Timing.Calls++;
+			}
+		}
+	}
+
+	FName ResolveName(const FString& InScopeName)
+	{
+		if (const FName* Cached = ResolvedNames.Find(InScopeName))
+		{
+			return *Cached;
+		}
+
+		// look for identifier equal to class name, "UMySubsystem::Tick" or "GameThread/MySubsystem"
+		FName Result;
+		int32 Start = INDEX_NONE;
+		for (int32 Idx = 0; Idx <= InScopeName.Len() && Result.IsNone(); ++Idx)
+		{
+			const bool bIdentifier = Idx < InScopeName.Len() && (FChar::IsAlnum(InScopeName[Idx]) || InScopeName[Idx] == TEXT('_'));
+			if (bIdentifier && Start == INDEX_NONE)
+			{
+				Start = Idx;
+			}
+			else if (!bIdentifier && Start != INDEX_NONE)
+			{
+				if (const FName* Found = ClassNames.Find(InScopeName.Mid(Start, Idx - Start)))
+				{
+					Result = *Found;
+				}
+				Start = INDEX_NONE;
+			}
+		}
+
+		if (ResolvedNames.Num() < SubsystemProfileImport::MaxResolvedNames)
+		{
+			ResolvedNames.Add(InScopeName, Result);
+		}
+		return Result;
+	}
+
+	TArray<uint8> LineBytes;
+	bool bLineTooLong = false;
+
+	bool bHeaderParsed = false;
+	FString HeaderLine;
+	TArray<FString> Fields;
+
+	int32 NameColumn = INDEX_NONE;
+	int32 DurationColumn = INDEX_NONE;
+	int32 StartColumn = INDEX_NONE;
+	int32 EndColumn = INDEX_NONE;
+	int32 CountColumn = INDEX_NONE;
+	int32 ThreadColumn = INDEX_NONE;
+	double DurationMsPerUnit = SubsystemProfileImport::MsPerSecond;
+	double StartMsPerUnit = SubsystemProfileImport::MsPerSecond;
+	double EndMsPerUnit = SubsystemProfileImport::MsPerSecond;
+	TArray<FName> FrameColumnKeys;
+	/* end of last counted event per thread and class, to skip nested events */
+	TMap<TTuple<FString, FName>, double> CountedEndTimes;
+
+	TMap<FString, FName> ResolvedNames;
+};
+
+FSubsystemProfileImport::~FSubsystemProfileImport()
+{
+	Reset();
+}
+
+bool FSubsystemProfileImport::Start(const FString& InFilePath, const TMap<FString, FName>& InClassNames)
+{
+	Reset();
+
+	const int64 FileSize = IFileManager::Get().FileSize(*InFilePath);
+	if (FileSize <= 0 || !InClassNames.Num())
+	{
+		return false;
+	}
+
+	Job = MakeShared<FJob, ESPMode::ThreadSafe>();
+	Job->FilePath = InFilePath;
+	Job->ClassNames = InClassNames;
+	Job->TotalBytes = FileSize;
+	Job->bTraceFile = IsTraceFile(InFilePath);
+
+	if (Job->bTraceFile && !SB_WITH_TRACE_IMPORT)
+	{
+		Job.Reset();
+		return false;
+	}
+
+	FilePath = InFilePath;
+
+	Async(EAsyncExecution::Thread, [InJob = Job]()
+	{
+		InJob->Run();
+	});
+
+	TickerHandle = FTickerHelper::AddTicker(FTickerDelegate::CreateRaw(this, &FSubsystemProfileImport::HandleTick), 0.1f);
+	return true;
+}
+
+void FSubsystemProfileImport::Reset()
+{
+	if (Job.IsValid())
+	{
+		// worker keeps its own reference and finishes on its own
+		Job->bCancelled = true;
+		Job.Reset();
+	}
+
+	FTickerHelper::RemoveTicker(TickerHandle);
+	Results.Empty();
+	FilePath.Empty();
+	bHasCallCounts = false;
+}
+
+bool FSubsystemProfileImport::ImportFile(const FString& InFilePath, const TMap<FString, FName>& InClassNames, TMap<FName, FSubsystemProfileTiming>& OutResults, bool& bOutHasCallCounts)
+{
+	FJob ImportJob;
+	ImportJob.FilePath = InFilePath;
+	ImportJob.ClassNames = InClassNames;
+	ImportJob.TotalBytes = IFileManager::Get().FileSize(*InFilePath);
+	ImportJob.bTraceFile = IsTraceFile(InFilePath);
+	if (ImportJob.TotalBytes <= 0 || (ImportJob.bTraceFile && !SB_WITH_TRACE_IMPORT))
+	{
+		return false;
+	}
+
+	ImportJob.Run();
+	if (!ImportJob.bSuccess)
+	{
+		return false;
+	}
+
+	OutResults = MoveTemp(ImportJob.Results);
+	bOutHasCallCounts = ImportJob.bHasCallCounts;
+	return true;
+}
+
+float FSubsystemProfileImport::GetProgress() const
+{
+	return Job.IsValid() && Job->TotalBytes > 0 ? (float)((double)Job->BytesRead.GetValue() / Job->TotalBytes) : 0.f;
+}
+
+bool FSubsystemProfileImport::IsTraceFile(const FString& InFilePath)
+{
+	return FPaths::GetExtension(InFilePath).Equals(TEXT("utrace"), ESearchCase::IgnoreCase);
+}
+
+void FSubsystemProfileImport::GatherClassNames(const TArray<UObject*>& InObjects, TMap<FString, FName>& OutClassNames)
+{
+	for (const UObject* Object : InObjects)
+	{
+		if (const UClass* Class = Object ? Object->GetClass() : nullptr)
+		{
+			OutClassNames.Add(Class->GetName(), Class->GetFName());
+			OutClassNames.Add(FString(Class->GetPrefixCPP()) + Class->GetName(), Class->GetFName());
+		}
+	}
+}
+
+bool FSubsystemProfileImport::HandleTick(float DeltaTime)
+{
+	if (!Job->bDone)
+	{
+		return true;
+	}
+
+	const bool bSuccess = Job->bSuccess;
+	if (bSuccess)
+	{
+		Results = MoveTemp(Job->Results);
+		bHasCallCounts = Job->bHasCallCounts;
+	}
+	else
+	{
+		FilePath.Empty();
+	}
+
+	// ticker is removed by returning false
+	Job.Reset();
+	TickerHandle.Reset();
+
+	OnCompleted.Broadcast(bSuccess);
+	return false;
+}
@@ -0,0 +1,92 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SubsystemBrowserTicker.h"
+#include "Misc/EngineVersionComparison.h"
+
+// trace files are read with TraceAnalysis, which has stable analyzer API since 5.0
+#if WITH_EDITOR && !UE_VERSION_OLDER_THAN(5, 0, 0)
+#define SB_WITH_TRACE_IMPORT 1
+#else
+#define SB_WITH_TRACE_IMPORT 0
+#endif
+
+/**
+ * Profiled timings aggregated for one subsystem class
+ */
+struct FSubsystemProfileTiming
+{
+	/* summary of all matched scope times */
+	double TotalMs = 0.0;
+	/* number of matched scope events, or frames with nonzero time when capture has no call counts */
+	int64 Calls = 0;
+};
+
+/**
+ * Importer of profiling captures that joins scope timings onto subsystem classes.
+ *
+ * All formats are read on a background thread:
+ *  - csvprofile output, where each column is a stat and each row a frame, values in milliseconds.
+ *    Calls are not recorded, frames with nonzero time are counted instead;
+ *  - Unreal Insights exports with one row per timer or timing event, recognized by Name/TimerName column.
+ *    Timing events use Duration or EndTime-StartTime in seconds, timer aggregates use Incl in milliseconds,
+ *    a unit after header name or value ("Incl (s)", "12.5 us") overrides that, Count column gives calls;
+ *  - Unreal Insights traces (.utrace), streamed through TraceAnalysis with an analyzer of CpuProfiler scopes,
+ *    so only CPU threads are read and timings are aggregated as events are decoded.
+ * Scopes nested in a scope of the same subsystem on the same thread are part of its time and are counted once.
+ * Files are read in fixed-size chunks, so memory use does not depend on capture size.
+ *
+ * Scope names are split into identifiers and matched against subsystem class names, with or without prefix,
+ * so both "UMySubsystem" and "UMySubsystem::Tick" scopes are attributed to UMySubsystem.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemProfileImport
+{
+public:
+	FSubsystemProfileImport() = default;
+	~FSubsystemProfileImport();
+
+	/* start importing file in background, timings are aggregated by provided class names */
+	bool Start(const FString& InFilePath, const TMap<FString, FName>& InClassNames);
+	/* stop running import and drop imported timings */
+	void Reset();
+
+	bool IsImporting() const { return Job.IsValid(); }
+	/* fraction of file processed by running import */
+	float GetProgress() const;
+
+	bool HasResults() const { return !FilePath.IsEmpty() && !IsImporting(); }
+	const FString& GetFilePath() const { return FilePath; }
+	/* were calls recorded by imported capture, per-frame captures count frames instead */
+	bool HasCallCounts() const { return bHasCallCounts; }
+
+	/* is file a trace that requires analysis */
+	static bool IsTraceFile(const FString& InFilePath);
+
+	/* import file on calling thread, blocks until whole file is read */
+	static bool ImportFile(const FString& InFilePath, const TMap<FString, FName>& InClassNames, TMap<FName, FSubsystemProfileTiming>& OutResults, bool& bOutHasCallCounts);
+
+	/* get timings of subsystem class */
+	const FSubsystemProfileTiming* Find(FName InClassName) const { return Results.Find(InClassName); }
+	int32 GetNumMatched() const { return Results.Num(); }
+
+	/* gather lookup of class names with and without prefix for subsystems */
+	static void GatherClassNames(const TArray<UObject*>& InObjects, TMap<FString, FName>& OutClassNames);
+
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnImportCompleted, bool /* bSuccess */);
+	/* delegate that is triggered on game thread when import finishes */
+	FOnImportCompleted OnCompleted;
+
+private:
+	bool HandleTick(float DeltaTime);
+
+	struct FJob;
+	TSharedPtr<FJob, ESPMode::ThreadSafe> Job;
+
+	FString FilePath;
+	TMap<FName, FSubsystemProfileTiming> Results;
+	bool bHasCallCounts = false;
+
+	FTickerHelper::FHandle TickerHandle;
+};
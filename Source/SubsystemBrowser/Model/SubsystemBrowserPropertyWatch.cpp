@@ -0,0 +1,249 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserPropertyWatch.h"
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserSettings.h"
+#include "SubsystemBrowserStyle.h"
+#include "SubsystemBrowserTrace.h"
+#include "SubsystemBrowserUtils.h"
+#include "PropertyEditorModule.h"
+#include "PropertyHandle.h"
+#include "Framework/Commands/UIAction.h"
+#include "UObject/UnrealType.h"
+
+#define LOCTEXT_NAMESPACE "SubsystemBrowser"
+
+void FSubsystemWatchHistory::Push(float InValue)
+{
+	Samples[Head] = InValue;
+	Head = (Head + 1) % Capacity;
+	NumSamples = FMath::Min(NumSamples + 1, Capacity);
+}
+
+void FSubsystemWatchHistory::Reset()
+{
+	Head = 0;
+	NumSamples = 0;
+}
+
+void FSubsystemWatchHistory::GetRange(float& OutMin, float& OutMax) const
+{
+	OutMin = OutMax = GetLatest();
+	for (int32 Idx = 0; Idx < NumSamples; ++Idx)
+	{
+		OutMin = FMath::Min(OutMin, Samples[Idx]);
+		OutMax = FMath::Max(OutMax, Samples[Idx]);
+	}
+}
+
+float FSubsystemPropertyWatch::ReadValue() const
+{
+	if (BoolProperty)
+	{
+		return BoolProperty->GetPropertyValue(ValuePtr) ? 1.f : 0.f;
+	}
+	if (NumericProperty->IsFloatingPoint())
+	{
+		return static_cast<float>(NumericProperty->GetFloatingPointPropertyValue(ValuePtr));
+	}
+	return static_cast<float>(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+}
+
+FSubsystemPropertyWatcher::~FSubsystemPropertyWatcher()
+{
+	FTickerHelper::RemoveTicker(TickerHandle);
+}
+
+void FSubsystemPropertyWatcher::Register()
+{
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+	FPropertyEditorModule& EditModule = FModuleManager::Get().LoadModuleChecked<FPropertyEditorModule>(TEXT("PropertyEditor"));
+	RowExtensionHandle = EditModule.GetGlobalRowExtensionDelegate().AddRaw(this, &FSubsystemPropertyWatcher::HandleGenerateRowExtension);
+#endif
+}
+
+void FSubsystemPropertyWatcher::Unregister()
+{
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+	if (FPropertyEditorModule* EditModule = FModuleManager::GetModulePtr<FPropertyEditorModule>(TEXT("PropertyEditor")))
+	{
+		EditModule->GetGlobalRowExtensionDelegate().Remove(RowExtensionHandle);
+	}
+	RowExtensionHandle.Reset();
+#endif
+
+	RemoveAllWatches();
+}
+
+bool FSubsystemPropertyWatcher::CanWatch(const TSharedPtr<IPropertyHandle>& InHandle)
+{
+	UObject* Object = nullptr;
+	void* ValuePtr = nullptr;
+	if (!FSubsystemBrowserUtils::ResolveStableValueAddress(InHandle, Object, ValuePtr))
+		return false;
+
+	const FProperty* Property = InHandle->GetProperty();
+	return Property->IsA<FNumericProperty>() || Property->IsA<FBoolProperty>();
+}
+
+bool FSubsystemPropertyWatcher::AddWatch(const TSharedPtr<IPropertyHandle>& InHandle)
+{
+	UObject* Object = nullptr;
+	void* ValuePtr = nullptr;
+	if (!CanWatch(InHandle) || !FSubsystemBrowserUtils::ResolveStableValueAddress(InHandle, Object, ValuePtr))
+		return false;
+
+	const FString Path = InHandle->GeneratePathToProperty();
+	if (IsWatched(Object, Path))
+		return true;
+
+	TUniquePtr<FSubsystemPropertyWatch> Watch = MakeUnique<FSubsystemPropertyWatch>();
+	Watch->Object = Object;
+	Watch->Path = Path;
+	Watch->ValuePtr = ValuePtr;
+	Watch->NumericProperty = CastField<FNumericProperty>(InHandle->GetProperty());
+	Watch->BoolProperty = CastField<FBoolProperty>(InHandle->GetProperty());
+	Watch->History.Push(Watch->ReadValue());
+	Watches.Add(MoveTemp(Watch));
+
+	UE_LOG(LogSubsystemBrowser, Log, TEXT("Watching %s of %s"), *Path, *GetNameSafe(Object));
+
+	UpdateTicker();
+	return true;
+}
+
+void FSubsystemPropertyWatcher::RemoveWatch(const UObject* InObject, const FString& InPath)
+{
+	Watches.RemoveAll([InObject, &InPath](const TUniquePtr<FSubsystemPropertyWatch>& Watch)
+	{
+		return Watch->Object.Get() == InObject && Watch->Path == InPath;
+	});
+
+	UpdateTicker();
+}
+
+void FSubsystemPropertyWatcher::ToggleWatch(TWeakPtr<IPropertyHandle> InHandle)
+{
+	TSharedPtr<IPropertyHandle> Handle = InHandle.Pin();
+	if (!CanWatch(Handle))
+		return;
+
+	TArray<UObject*> OuterObjects;
+	Handle->GetOuterObjects(OuterObjects);
+
+	const FString Path = Handle->GeneratePathToProperty();
+	if (IsWatched(OuterObjects[0], Path))
+	{
+		RemoveWatch(OuterObjects[0], Path);
+	}
+	else
+	{
+		AddWatch(Handle);
+	}
+}
+
+bool FSubsystemPropertyWatcher::IsWatched(const UObject* InObject, const FString& InPath) const
+{
+	return Watches.ContainsByPredicate([InObject, &InPath](const TUniquePtr<FSubsystemPropertyWatch>& Watch)
+	{
+		return Watch->Object.Get() == InObject && Watch->Path == InPath;
+	});
+}
+
+bool FSubsystemPropertyWatcher::IsHandleWatched(TWeakPtr<IPropertyHandle> InHandle) const
+{
+	TSharedPtr<IPropertyHandle> Handle = InHandle.Pin();
+	if (!CanWatch(Handle))
+		return false;
+
+	TArray<UObject*> OuterObjects;
+	Handle->GetOuterObjects(OuterObjects);
+	return IsWatched(OuterObjects[0], Handle->GeneratePathToProperty());
+}
+
+void FSubsystemPropertyWatcher::RemoveAllWatches()
+{
+	Watches.Empty();
+	UpdateTicker();
+}
+
+bool FSubsystemPropertyWatcher::HasWatches(const UObject* InObject) const
+{
+	return Watches.ContainsByPredicate([InObject](const TUniquePtr<FSubsystemPropertyWatch>& Watch)
+	{
+		return Watch->Object.Get() == InObject;
+	});
+}
+
+void FSubsystemPropertyWatcher::SampleWatches()
+{
+	SB_TRACE_SCOPE(FSubsystemPropertyWatcher::SampleWatches);
+
+	const int32 NumRemoved = Watches.RemoveAll([](const TUniquePtr<FSubsystemPropertyWatch>& Watch)
+	{
+		return !Watch->Object.IsValid();
+	});
+
+	for (const TUniquePtr<FSubsystemPropertyWatch>& Watch : Watches)
+	{
+		Watch->History.Push(Watch->ReadValue());
+	}
+
+	if (NumRemoved)
+	{
+		UpdateTicker();
+	}
+}
+
+bool FSubsystemPropertyWatcher::HandleTick(float DeltaTime)
+{
+	TimeSinceSample += DeltaTime;
+	if (TimeSinceSample >= USubsystemBrowserSettings::Get()->GetWatchSampleInterval())
+	{
+		TimeSinceSample = 0.f;
+		SampleWatches();
+	}
+	return true;
+}
+
+void FSubsystemPropertyWatcher::UpdateTicker()
+{
+	if (Watches.Num() && !TickerHandle.IsValid())
+	{
+		TimeSinceSample = 0.f;
+		TickerHandle = FTickerHelper::AddTicker(FTickerDelegate::CreateRaw(this, &FSubsystemPropertyWatcher::HandleTick));
+	}
+	else if (!Watches.Num())
+	{
+		FTickerHelper::RemoveTicker(TickerHandle);
+	}
+}
+
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+void FSubsystemPropertyWatcher::HandleGenerateRowExtension(const FOnGenerateGlobalRowExtensionArgs& Args, TArray<FPropertyRowExtensionButton>& OutExtensions)
+{
+	if (!CanWatch(Args.PropertyHandle))
+		return;
+
+	// only offer watching for subsystems and their subobjects
+	TArray<UObject*> OuterObjects;
+	Args.PropertyHandle->GetOuterObjects(OuterObjects);
+	if (!FSubsystemBrowserUtils::IsSubsystemOrSubobject(OuterObjects[0]))
+		return;
+
+	TWeakPtr<IPropertyHandle> WeakHandle = Args.PropertyHandle;
+
+	FPropertyRowExtensionButton& Button = OutExtensions.AddDefaulted_GetRef();
+	Button.Icon = FStyleHelper::GetSlateIcon("Icons.Visible");
+	Button.Label = LOCTEXT("WatchProperty", "Watch Property");
+	Button.ToolTip = LOCTEXT("WatchProperty_Tooltip", "Record history of this value and display it in Watch column of Subsystem Browser");
+	Button.UIAction = FUIAction(
+		FExecuteAction::CreateRaw(this, &FSubsystemPropertyWatcher::ToggleWatch, WeakHandle),
+		FCanExecuteAction(),
+		FIsActionChecked::CreateRaw(this, &FSubsystemPropertyWatcher::IsHandleWatched, WeakHandle)
+	);
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,117 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SubsystemBrowserTicker.h"
+#include "UObject/WeakObjectPtr.h"
+
+class IPropertyHandle;
+class FProperty;
+class FNumericProperty;
+class FBoolProperty;
+struct FOnGenerateGlobalRowExtensionArgs;
+struct FPropertyRowExtensionButton;
+
+/**
+ * Fixed capacity history of property samples.
+ * Storage is inline so recording a sample never allocates.
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemWatchHistory
+{
+	static constexpr int32 Capacity = 128;
+
+	void Push(float InValue);
+	void Reset();
+
+	int32 Num() const { return NumSamples; }
+	/* get sample by index, 0 is the oldest one */
+	float Get(int32 InIndex) const { return Samples[(Head - NumSamples + InIndex + Capacity) % Capacity]; }
+	float GetLatest() const { return NumSamples ? Get(NumSamples - 1) : 0.f; }
+	void GetRange(float& OutMin, float& OutMax) const;
+
+private:
+	float Samples[Capacity] = { };
+	/* index of next sample to write */
+	int32 Head = 0;
+	int32 NumSamples = 0;
+};
+
+/**
+ * Single watched numeric or boolean property of a live object
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemPropertyWatch
+{
+	TWeakObjectPtr<UObject> Object;
+	/* property path as displayed in details view */
+	FString Path;
+	/* address of value within object, resolved once when watch is added */
+	const void* ValuePtr = nullptr;
+	const FNumericProperty* NumericProperty = nullptr;
+	const FBoolProperty* BoolProperty = nullptr;
+
+	FSubsystemWatchHistory History;
+
+	/* read current value as float */
+	float ReadValue() const;
+};
+
+/**
+ * Registry of watched properties.
+ *
+ * Watches are sampled on core ticker every frame or at configured interval into their ring buffers.
+ * Sampling reads value at address resolved on watch creation, property paths are not resolved again.
+ * Watches of destroyed objects are dropped on next sample and ticker stops once none remain.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemPropertyWatcher
+{
+public:
+	FSubsystemPropertyWatcher() = default;
+	~FSubsystemPropertyWatcher();
+
+	/* register details view row actions */
+	void Register();
+	void Unregister();
+
+	/* check if property behind handle has a value that can be watched */
+	static bool CanWatch(const TSharedPtr<IPropertyHandle>& InHandle);
+
+	bool AddWatch(const TSharedPtr<IPropertyHandle>& InHandle);
+	void RemoveWatch(const UObject* InObject, const FString& InPath);
+	void ToggleWatch(TWeakPtr<IPropertyHandle> InHandle);
+	bool IsWatched(const UObject* InObject, const FString& InPath) const;
+	bool IsHandleWatched(TWeakPtr<IPropertyHandle> InHandle) const;
+	void RemoveAllWatches();
+
+	int32 GetNumWatches() const { return Watches.Num(); }
+	bool HasWatches(const UObject* InObject) const;
+
+	template<typename TFunc>
+	void ForEachWatch(const UObject* InObject, TFunc&& InFunc) const
+	{
+		for (const TUniquePtr<FSubsystemPropertyWatch>& Watch : Watches)
+		{
+			if (Watch->Object.Get() == InObject)
+			{
+				InFunc(*Watch);
+			}
+		}
+	}
+
+	/* record a sample for each watch of alive object, watches of destroyed objects are removed */
+	void SampleWatches();
+
+private:
+	bool HandleTick(float DeltaTime);
+	void UpdateTicker();
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+	void HandleGenerateRowExtension(const FOnGenerateGlobalRowExtensionArgs& Args, TArray<FPropertyRowExtensionButton>& OutExtensions);
+#endif
+
+	/* watches carry inline histories, so keep them behind pointers to make array growth cheap */
+	TArray<TUniquePtr<FSubsystemPropertyWatch>> Watches;
+
+	FTickerHelper::FHandle TickerHandle;
+	float TimeSinceSample = 0.f;
+	FDelegateHandle RowExtensionHandle;
+};
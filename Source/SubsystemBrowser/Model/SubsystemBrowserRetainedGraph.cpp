@@ -0,0 +1,252 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserRetainedGraph.h"
+
+#include "SubsystemBrowserTrace.h"
+#include "Model/SubsystemBrowserMemoryStats.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Subsystems/Subsystem.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/Package.h"
+
+namespace SubsystemRetainedGraph
+{
+	/* maximum time to spend walking references per frame */
+	static constexpr double FrameBudget = 0.002;
+	/* minimum seconds between publishing partial results, each publish rebuilds displayed children */
+	static constexpr double UpdateInterval = 0.5;
+	/* analysis stops after this many objects were found */
+	static constexpr int32 MaxObjects = 100000;
+}
+
+FSubsystemRetainedGraph::FSubsystemRetainedGraph(UObject* InRoot, UWorld* InWorld)
+	: Root(InRoot), World(InWorld)
+{
+}
+
+FSubsystemRetainedGraph::~FSubsystemRetainedGraph()
+{
+	FTickerHelper::RemoveTicker(TickerHandle);
+}
+
+void FSubsystemRetainedGraph::Start()
+{
+	Cancel();
+
+	Visited.Reset();
+	Queue.Reset();
+	QueueHead = 0;
+	References.Reset();
+	ReferenceIndex = 0;
+	ClassStats.Reset();
+	ClassStatsIndex.Reset();
+	NumObjects = 0;
+	TotalBytes = 0;
+	NumInOtherWorlds = 0;
+	NumInTransientPackage = 0;
+	bTruncated = false;
+	bHasPendingChanges = false;
+	LastUpdateTime = FPlatformTime::Seconds();
+	Revision++;
+
+	if (UObject* RootObject = Root.Get())
+	{
+		Visited.Add(FObjectKey(RootObject));
+		Queue.Add(RootObject);
+
+		TickerHandle = FTickerHelper::AddTicker(FTickerDelegate::CreateSP(this, &FSubsystemRetainedGraph::HandleTick));
+	}
+}
+
+void FSubsystemRetainedGraph::Cancel()
+{
+	FTickerHelper::RemoveTicker(TickerHandle);
+
+	// publish partial results that were not yet published
+	if (bHasPendingChanges)
+	{
+		bHasPendingChanges = false;
+		Revision++;
+		OnUpdated.Broadcast();
+	}
+}
+
+bool FSubsystemRetainedGraph::HandleTick(float DeltaTime)
+{
+	SB_TRACE_SCOPE(FSubsystemRetainedGraph::HandleTick);
+
+	const double Deadline = FPlatformTime::Seconds() + SubsystemRetainedGraph::FrameBudget;
+	const bool bHasMoreWork = Step(Deadline);
+
+	if (!bHasMoreWork)
+	{
+		// nothing left to walk, ticker is removed by returning false
+		Queue.Empty();
+		QueueHead = 0;
+		References.Empty();
+		ReferenceIndex = 0;
+		TickerHandle.Reset();
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (!bHasMoreWork || (bHasPendingChanges && Now - LastUpdateTime >= SubsystemRetainedGraph::UpdateInterval))
+	{
+		bHasPendingChanges = false;
+		LastUpdateTime = Now;
+		Revision++;
+		OnUpdated.Broadcast();
+	}
+
+	return bHasMoreWork;
+}
+
+bool FSubsystemRetainedGraph::Step(double InDeadline)
+{
+	// reused between objects to avoid reallocations
+	TArray<UObject*> FoundReferences;
+
+	while (Root.IsValid() && !bTruncated)
+	{
+		// measuring sizes dominates, so budget is checked per reference and object expansion resumes next frame
+		for (; ReferenceIndex < References.Num(); ++ReferenceIndex)
+		{
+			if (FPlatformTime::Seconds() >= InDeadline)
+			{
+				return true;
+			}
+
+			UObject* const Reference = References[ReferenceIndex].Get();
+			if (!Reference || IsIgnored(Reference))
+				continue;
+
+			bool bAlreadyVisited = false;
+			Visited.Add(FObjectKey(Reference), &bAlreadyVisited);
+			if (bAlreadyVisited)
+				continue;
+
+			if (NumObjects >= SubsystemRetainedGraph::MaxObjects)
+			{
+				bTruncated = true;
+				return false;
+			}
+
+			Record(Reference);
+
+			if (!IsBoundary(Reference))
+			{
+				Queue.Add(Reference);
+			}
+		}
+
+		if (QueueHead >= Queue.Num())
+		{
+			return false;
+		}
+		if (FPlatformTime::Seconds() >= InDeadline)
+		{
+			return true;
+		}
+
+		References.Reset();
+		ReferenceIndex = 0;
+
+		UObject* const Object = Queue[QueueHead++].Get();
+		if (!Object)
+			continue;
+
+		// references are held weakly since expansion may span garbage collection
+		FoundReferences.Reset();
+		FReferenceFinder Finder(FoundReferences, nullptr, false, true, false, false);
+		Finder.FindReferences(Object);
+
+		References.Reserve(FoundReferences.Num());
+		for (UObject* Reference : FoundReferences)
+		{
+			References.Add(Reference);
+		}
+	}
+
+	return false;
+}
+
+void FSubsystemRetainedGraph::Record(UObject* InObject)
+{
+	UClass* const Class = InObject->GetClass();
+
+	int32& Index = ClassStatsIndex.FindOrAdd(FObjectKey(Class), INDEX_NONE);
+	if (Index == INDEX_NONE)
+	{
+		Index = ClassStats.AddDefaulted();
+		ClassStats[Index].Class = Class;
+		ClassStats[Index].ClassName = Class->GetName();
+		ClassStats[Index].SampleObject = InObject;
+	}
+
+	FSubsystemRetainedClassStats& Stats = ClassStats[Index];
+
+	const uint64 Bytes = FSubsystemMemoryStats::MeasureObject(InObject);
+	Stats.NumObjects++;
+	Stats.Bytes += Bytes;
+	NumObjects++;
+	TotalBytes += Bytes;
+
+	if (IsInOtherWorld(InObject))
+	{
+		Stats.NumInOtherWorlds++;
+		NumInOtherWorlds++;
+	}
+	if (IsInTransientPackage(InObject))
+	{
+		Stats.NumInTransientPackage++;
+		NumInTransientPackage++;
+	}
+
+	bHasPendingChanges = true;
+}
+
+bool FSubsystemRetainedGraph::IsIgnored(const UObject* InObject) const
+{
+	// types and default objects are always alive and would only add noise
+	return InObject->IsA<UField>()
+		|| InObject->IsA<UPackage>()
+		|| InObject->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject);
+}
+
+bool FSubsystemRetainedGraph::IsBoundary(const UObject* InObject) const
+{
+	// owners of subsystems keep whole worlds alive, other subsystems are analyzed separately
+	return InObject->IsRooted()
+		|| InObject->IsA<UWorld>()
+		|| InObject->IsA<ULevel>()
+		|| InObject->IsA<UGameInstance>()
+		|| InObject->IsA<UEngine>()
+		|| InObject->IsA<USubsystem>()
+		|| IsInOtherWorld(InObject);
+}
+
+bool FSubsystemRetainedGraph::IsInTransientPackage(const UObject* InObject)
+{
+	// engine itself lives in transient package, so its game instances and their objects are owned, not stray
+	for (const UObject* Outer = InObject->GetOuter(); Outer; Outer = Outer->GetOuter())
+	{
+		if (Outer->IsA<UEngine>() || Outer->IsA<UGameInstance>() || Outer->IsA<UWorld>() || Outer->IsA<ULevel>())
+		{
+			return false;
+		}
+		if (Outer == GetTransientPackage())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FSubsystemRetainedGraph::IsInOtherWorld(const UObject* InObject) const
+{
+	const UWorld* ObjectWorld = InObject->IsA<UWorld>() ? static_cast<const UWorld*>(InObject) : InObject->GetTypedOuter<UWorld>();
+	return ObjectWorld != nullptr && ObjectWorld != World.Get();
+}
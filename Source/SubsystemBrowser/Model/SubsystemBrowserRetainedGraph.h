@@ -0,0 +1,103 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SubsystemBrowserTicker.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+/**
+ * Objects of one class reachable from analyzed subsystem
+ */
+struct FSubsystemRetainedClassStats
+{
+	TWeakObjectPtr<UClass> Class;
+	FString ClassName;
+	int32 NumObjects = 0;
+	/* summary of exclusive sizes of all objects */
+	uint64 Bytes = 0;
+	/* number of objects that belong to a world other than the browsed one */
+	int32 NumInOtherWorlds = 0;
+	/* number of objects owned by transient package rather than engine, game instance or world */
+	int32 NumInTransientPackage = 0;
+	/* first found object, to inspect in details view */
+	TWeakObjectPtr<UObject> SampleObject;
+
+	bool HasWarnings() const { return NumInOtherWorlds > 0 || NumInTransientPackage > 0; }
+};
+
+/**
+ * Breadth-first walk over objects referenced by a subsystem, performed on game thread in time slices.
+ *
+ * References are gathered with FReferenceFinder from reflected properties and AddReferencedObjects.
+ * Every object is visited once; types, packages, default objects are ignored and traversal stops at
+ * worlds, levels, rooted objects, other subsystems and objects of other worlds, so result describes
+ * what the subsystem itself keeps alive rather than the whole engine.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemRetainedGraph : public TSharedFromThis<FSubsystemRetainedGraph>
+{
+public:
+	FSubsystemRetainedGraph(UObject* InRoot, UWorld* InWorld);
+	~FSubsystemRetainedGraph();
+
+	/* begin analysis from scratch */
+	void Start();
+	/* stop analysis keeping partial results */
+	void Cancel();
+
+	bool IsRunning() const { return TickerHandle.IsValid(); }
+	/* was analysis stopped early because object limit was reached */
+	bool IsTruncated() const { return bTruncated; }
+
+	UObject* GetRoot() const { return Root.Get(); }
+	/* incremented when results change, at most once per update interval while running and once analysis completes */
+	uint32 GetRevision() const { return Revision; }
+
+	int32 GetNumObjects() const { return NumObjects; }
+	uint64 GetTotalBytes() const { return TotalBytes; }
+	int32 GetNumInOtherWorlds() const { return NumInOtherWorlds; }
+	int32 GetNumInTransientPackage() const { return NumInTransientPackage; }
+
+	const TArray<FSubsystemRetainedClassStats>& GetClassStats() const { return ClassStats; }
+
+	/* triggered together with revision change */
+	FSimpleMulticastDelegate OnUpdated;
+
+private:
+	bool HandleTick(float DeltaTime);
+	/* expand queued objects until deadline, resuming partially expanded object. returns false when nothing is left */
+	bool Step(double InDeadline);
+	void Record(UObject* InObject);
+
+	bool IsIgnored(const UObject* InObject) const;
+	bool IsBoundary(const UObject* InObject) const;
+	bool IsInOtherWorld(const UObject* InObject) const;
+	static bool IsInTransientPackage(const UObject* InObject);
+
+	TWeakObjectPtr<UObject> Root;
+	TWeakObjectPtr<UWorld> World;
+
+	TSet<FObjectKey> Visited;
+	TArray<TWeakObjectPtr<UObject>> Queue;
+	int32 QueueHead = 0;
+	/* references of object being expanded, kept between frames when budget runs out mid-object */
+	TArray<TWeakObjectPtr<UObject>> References;
+	int32 ReferenceIndex = 0;
+
+	TArray<FSubsystemRetainedClassStats> ClassStats;
+	TMap<FObjectKey, int32> ClassStatsIndex;
+
+	int32 NumObjects = 0;
+	uint64 TotalBytes = 0;
+	int32 NumInOtherWorlds = 0;
+	int32 NumInTransientPackage = 0;
+	bool bTruncated = false;
+	uint32 Revision = 0;
+	/* time of last revision change while running */
+	double LastUpdateTime = 0.0;
+	/* objects recorded since last revision change */
+	bool bHasPendingChanges = false;
+
+	FTickerHelper::FHandle TickerHandle;
+};
@@ -0,0 +1,317 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserSnapshot.h"
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserTrace.h"
+#include "SubsystemBrowserUtils.h"
+#include "Model/SubsystemBrowserModel.h"
+#include "Model/SubsystemBrowserPerfStats.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/Paths.h"
+#include "UObject/UnrealType.h"
+
+namespace SubsystemSnapshot
+{
+	/* 'SBSN' */
+	static constexpr uint32 FileMagic = 0x4E534253;
+
+	enum EVersion : int32
+	{
+		Initial = 1,
+
+		VersionPlusOne,
+		Latest = VersionPlusOne - 1
+	};
+
+	/* Indices are stored shifted by one so INDEX_NONE packs into a single byte */
+	static void SerializeIndex(FArchive& Ar, int32& Value)
+	{
+		uint32 Packed = (uint32)(Value + 1);
+		Ar.SerializeIntPacked(Packed);
+		Value = (int32)Packed - 1;
+	}
+
+	/* Reads element count and rejects values that can not fit in remaining data */
+	static bool SerializeNum(FArchive& Ar, int32& Num)
+	{
+		Ar << Num;
+		return !Ar.IsError() && Num >= 0 && (!Ar.IsLoading() || Ar.TotalSize() < 0 || Num <= Ar.TotalSize() - Ar.Tell());
+	}
+
+	static void HandleCaptureCommand(const TArray<FString>& Args, UWorld* InWorld)
+	{
+		const bool bIncludeSubobjects = Args.Num() && Args[0].Equals(TEXT("subobjects"), ESearchCase::IgnoreCase);
+
+		TSharedRef<FSubsystemSnapshot> Snapshot = FSubsystemSnapshot::Capture(InWorld, bIncludeSubobjects);
+
+		const FString FilePath = Snapshot->MakeDefaultFilePath();
+		if (Snapshot->SaveToFile(FilePath))
+		{
+			UE_LOG(LogSubsystemBrowser, Display, TEXT("Subsystem snapshot of %d objects saved to %s"), Snapshot->Objects.Num(), *FilePath);
+		}
+		else
+		{
+			UE_LOG(LogSubsystemBrowser, Error, TEXT("Failed to save subsystem snapshot to %s"), *FilePath);
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs CaptureCommand(
+		TEXT("SubsystemBrowser.CaptureSnapshot"),
+		TEXT("Capture reflected state of all subsystems in current world into Saved/SubsystemBrowser/Snapshots. Use 'SubsystemBrowser.CaptureSnapshot subobjects' to include subobjects."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleCaptureCommand)
+	);
+}
+
+const FString& FSubsystemSnapshot::GetString(int32 InIndex) const
+{
+	static const FString Empty;
+	return Strings.IsValidIndex(InIndex) ? Strings[InIndex] : Empty;
+}
+
+int32 FSubsystemSnapshot::AddString(const FString& InString)
+{
+	if (const int32* Existing = StringLookup.Find(InString))
+	{
+		return *Existing;
+	}
+
+	const int32 Index = Strings.Add(InString);
+	StringHashes.Add(FCrc::StrCrc32(*InString));
+	StringLookup.Add(InString, Index);
+	return Index;
+}
+
+TSharedRef<FSubsystemSnapshot> FSubsystemSnapshot::Capture(const FSubsystemModel& InModel, bool bIncludeSubobjects)
+{
+	SB_TRACE_SCOPE(FSubsystemSnapshot::Capture);
+	FSubsystemPerfStats::FScope PerfScope(FSubsystemPerfStats::GetShared(), ESubsystemPerfMetric::SnapshotCapture);
+
+	TSharedRef<FSubsystemSnapshot> Snapshot = MakeShared<FSubsystemSnapshot>();
+	Snapshot->WorldName = GetNameSafe(InModel.GetCurrentWorld().Get());
+	Snapshot->Timestamp = FDateTime::UtcNow();
+	Snapshot->Objects.Reserve(InModel.GetAllSubsystems().Num());
+
+	TArray<UObject*> Subobjects;
+	for (const SubsystemTreeItemPtr& Item : InModel.GetAllSubsystems())
+	{
+		UObject* const Object = Item->GetObjectForDetails();
+		if (!IsValid(Object))
+		{
+			continue;
+		}
+
+		const FString Category = Item->GetParent().IsValid() ? Item->GetParent()->GetID().ToString() : FString();
+
+		const int32 ObjectIndex = Snapshot->Objects.Num();
+		Snapshot->CaptureObject(Object, Category, INDEX_NONE);
+
+		if (bIncludeSubobjects)
+		{
+			FSubsystemBrowserUtils::DefaultSelectSubsystemSubobjects(Object, Subobjects);
+			for (UObject* Subobject : Subobjects)
+			{
+				if (IsValid(Subobject))
+				{
+					Snapshot->CaptureObject(Subobject, Category, ObjectIndex);
+				}
+			}
+		}
+	}
+
+	// lookups are only needed while capturing
+	Snapshot->StringLookup.Empty();
+	Snapshot->StringHashes.Empty();
+
+	PerfScope.SetNumItems(Snapshot->Objects.Num());
+	return Snapshot;
+}
+
+TSharedRef<FSubsystemSnapshot> FSubsystemSnapshot::Capture(UWorld* InWorld, bool bIncludeSubobjects)
+{
+	TSharedRef<FSubsystemModel> Model = MakeShared<FSubsystemModel>();
+	Model->SetCurrentWorld(InWorld);
+	return Capture(*Model, bIncludeSubobjects);
+}
+
+void FSubsystemSnapshot::CaptureObject(UObject* InObject, const FString& InCategory, int32 InParentIndex)
+{
+	UClass* const Class = InObject->GetClass();
+
+	FSubsystemSnapshotObject& Record = Objects.AddDefaulted_GetRef();
+	Record.CategoryIndex = AddString(InCategory);
+	Record.ClassIndex = AddString(Class->GetPathName());
+	Record.NameIndex = AddString(InObject->GetName());
+	Record.ParentIndex = InParentIndex;
+
+	// reused between properties to avoid reallocations
+	FString ExportValue;
+	FString PropertyPath;
+
+	for (TFieldIterator<FProperty> It(Class); It; ++It)
+	{
+		FProperty* Property = *It;
+		if (Property->HasAnyPropertyFlags(CPF_Deprecated))
+			continue;
+
+		for (int32 Idx = 0; Idx < Property->ArrayDim; Idx++)
+		{
+			const uint8* DataPtr = Property->ContainerPtrToValuePtr<uint8>(InObject, Idx);
+
+			ExportValue.Reset();
+#if UE_VERSION_OLDER_THAN(5,1,0)
+			Property->ExportTextItem(ExportValue, DataPtr, nullptr, InObject, PPF_None);
+#else
+			Property->ExportTextItem_Direct(ExportValue, DataPtr, nullptr, InObject, PPF_None);
+#endif
+
+			PropertyPath = Property->GetName();
+			if (Property->ArrayDim > 1)
+			{
+				PropertyPath += FString::Printf(TEXT("[%d]"), Idx);
+			}
+
+			FSubsystemSnapshotProperty& PropertyRecord = Record.Properties.AddDefaulted_GetRef();
+			PropertyRecord.PathIndex = AddString(PropertyPath);
+			PropertyRecord.ValueIndex = AddString(ExportValue);
+			PropertyRecord.Hash = StringHashes[PropertyRecord.ValueIndex];
+
+			Record.Hash = HashCombine(Record.Hash, HashCombine(StringHashes[PropertyRecord.PathIndex], PropertyRecord.Hash));
+		}
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FSubsystemSnapshot& Snapshot)
+{
+	using namespace SubsystemSnapshot;
+
+	uint32 Magic = FileMagic;
+	Ar << Magic;
+	if (Magic != FileMagic)
+	{
+		Ar.SetError();
+		return Ar;
+	}
+
+	int32 Version = EVersion::Latest;
+	Ar << Version;
+	if (Version < EVersion::Initial || Version > EVersion::Latest)
+	{
+		Ar.SetError();
+		return Ar;
+	}
+
+	Ar << Snapshot.WorldName;
+	Ar << Snapshot.Timestamp;
+
+	int32 NumStrings = Snapshot.Strings.Num();
+	if (!SerializeNum(Ar, NumStrings))
+	{
+		Ar.SetError();
+		return Ar;
+	}
+	if (Ar.IsLoading())
+	{
+		Snapshot.Strings.SetNum(NumStrings);
+	}
+	for (FString& String : Snapshot.Strings)
+	{
+		Ar << String;
+	}
+
+	int32 NumObjects = Snapshot.Objects.Num();
+	if (!SerializeNum(Ar, NumObjects))
+	{
+		Ar.SetError();
+		return Ar;
+	}
+	if (Ar.IsLoading())
+	{
+		Snapshot.Objects.SetNum(NumObjects);
+	}
+	for (FSubsystemSnapshotObject& Object : Snapshot.Objects)
+	{
+		SerializeIndex(Ar, Object.CategoryIndex);
+		SerializeIndex(Ar, Object.ClassIndex);
+		SerializeIndex(Ar, Object.NameIndex);
+		SerializeIndex(Ar, Object.ParentIndex);
+		Ar << Object.Hash;
+
+		int32 NumProperties = Object.Properties.Num();
+		if (!SerializeNum(Ar, NumProperties))
+		{
+			Ar.SetError();
+			return Ar;
+		}
+		if (Ar.IsLoading())
+		{
+			Object.Properties.SetNum(NumProperties);
+		}
+		for (FSubsystemSnapshotProperty& Property : Object.Properties)
+		{
+			SerializeIndex(Ar, Property.PathIndex);
+			SerializeIndex(Ar, Property.ValueIndex);
+			Ar << Property.Hash;
+		}
+	}
+
+	return Ar;
+}
+
+bool FSubsystemSnapshot::SaveToFile(const FString& InFilePath) const
+{
+	SB_TRACE_SCOPE(FSubsystemSnapshot::SaveToFile);
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*InFilePath));
+	if (!Writer.IsValid())
+	{
+		return false;
+	}
+
+	*Writer << const_cast<FSubsystemSnapshot&>(*this);
+	return Writer->Close() && !Writer->IsError();
+}
+
+TSharedPtr<FSubsystemSnapshot> FSubsystemSnapshot::LoadFromFile(const FString& InFilePath)
+{
+	SB_TRACE_SCOPE(FSubsystemSnapshot::LoadFromFile);
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*InFilePath));
+	if (!Reader.IsValid())
+	{
+		return nullptr;
+	}
+
+	TSharedRef<FSubsystemSnapshot> Snapshot = MakeShared<FSubsystemSnapshot>();
+	*Reader << *Snapshot;
+
+	if (!Reader->Close() || Reader->IsError())
+	{
+		UE_LOG(LogSubsystemBrowser, Warning, TEXT("%s is not a valid subsystem snapshot"), *InFilePath);
+		return nullptr;
+	}
+
+	return Snapshot;
+}
+
+FString FSubsystemSnapshot::GetSnapshotDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SubsystemBrowser"), TEXT("Snapshots"));
+}
+
+FString FSubsystemSnapshot::MakeDefaultFilePath() const
+{
+	const FString FileName = FString::Printf(TEXT("%s-%s.sbsnap"), *WorldName, *Timestamp.ToString(TEXT("%Y%m%d-%H%M%S-%s")));
+	return FPaths::ConvertRelativePathToFull(FPaths::Combine(GetSnapshotDirectory(), FileName));
+}
+
+FString FSubsystemSnapshot::CaptureToDefaultFile(const FSubsystemModel& InModel, bool bIncludeSubobjects)
+{
+	TSharedRef<FSubsystemSnapshot> Snapshot = Capture(InModel, bIncludeSubobjects);
+
+	const FString FilePath = Snapshot->MakeDefaultFilePath();
+	return Snapshot->SaveToFile(FilePath) ? FilePath : FString();
+}
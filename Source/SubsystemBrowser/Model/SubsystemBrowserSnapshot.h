@@ -0,0 +1,87 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSubsystemModel;
+
+/**
+ * Captured value of a single reflected property
+ */
+struct FSubsystemSnapshotProperty
+{
+	/* index of property path in string table */
+	int32 PathIndex = INDEX_NONE;
+	/* index of exported property value in string table */
+	int32 ValueIndex = INDEX_NONE;
+	/* hash of exported property value */
+	uint32 Hash = 0;
+};
+
+/**
+ * Captured state of a single subsystem or subobject
+ */
+struct FSubsystemSnapshotObject
+{
+	/* index of category name in string table */
+	int32 CategoryIndex = INDEX_NONE;
+	/* index of class path in string table */
+	int32 ClassIndex = INDEX_NONE;
+	/* index of object name in string table */
+	int32 NameIndex = INDEX_NONE;
+	/* index of owning subsystem within snapshot objects, INDEX_NONE for subsystems */
+	int32 ParentIndex = INDEX_NONE;
+	/* combined hash of all property paths and values */
+	uint32 Hash = 0;
+
+	TArray<FSubsystemSnapshotProperty> Properties;
+};
+
+/**
+ * Reflected state of every subsystem in a model at a given moment.
+ *
+ * All strings (names, property paths and values) are deduplicated into a string table,
+ * objects and properties refer to it by index.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemSnapshot
+{
+public:
+	/* Name of world snapshot was captured from */
+	FString WorldName;
+	/* Capture time in UTC */
+	FDateTime Timestamp;
+
+	TArray<FString> Strings;
+	TArray<FSubsystemSnapshotObject> Objects;
+
+	const FString& GetString(int32 InIndex) const;
+
+	/* Capture every subsystem of model and optionally their subobjects */
+	static TSharedRef<FSubsystemSnapshot> Capture(const FSubsystemModel& InModel, bool bIncludeSubobjects);
+
+	/* Capture every subsystem of a world using registered categories */
+	static TSharedRef<FSubsystemSnapshot> Capture(UWorld* InWorld, bool bIncludeSubobjects);
+
+	bool SaveToFile(const FString& InFilePath) const;
+	static TSharedPtr<FSubsystemSnapshot> LoadFromFile(const FString& InFilePath);
+
+	/* Directory snapshots are stored in by default */
+	static FString GetSnapshotDirectory();
+	/* Default file path for a new snapshot */
+	FString MakeDefaultFilePath() const;
+
+	/* Capture current world of model and save it to default location, returns file path or empty string on failure */
+	static FString CaptureToDefaultFile(const FSubsystemModel& InModel, bool bIncludeSubobjects);
+
+	friend FArchive& operator<<(FArchive& Ar, FSubsystemSnapshot& Snapshot);
+
+private:
+	int32 AddString(const FString& InString);
+	void CaptureObject(UObject* InObject, const FString& InCategory, int32 InParentIndex);
+
+	/* Lookup used to deduplicate strings during capture */
+	TMap<FString, int32> StringLookup;
+	/* Hash of each string in table, filled during capture */
+	TArray<uint32> StringHashes;
+};
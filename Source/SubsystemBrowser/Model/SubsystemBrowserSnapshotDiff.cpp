@@ -0,0 +1,144 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserSnapshotDiff.h"
+
+#include "SubsystemBrowserTrace.h"
+#include "Model/SubsystemBrowserSnapshot.h"
+
+namespace SubsystemSnapshotDiff
+{
+	/* Key used to match same object between snapshots */
+	static FString MakeObjectKey(const FSubsystemSnapshot& InSnapshot, const FSubsystemSnapshotObject& InObject)
+	{
+		const FString& ParentName = InSnapshot.Objects.IsValidIndex(InObject.ParentIndex)
+			? InSnapshot.GetString(InSnapshot.Objects[InObject.ParentIndex].NameIndex)
+			: InSnapshot.GetString(INDEX_NONE);
+
+		return FString::Printf(TEXT("%s|%s|%s|%s"),
+			*InSnapshot.GetString(InObject.CategoryIndex),
+			*InSnapshot.GetString(InObject.ClassIndex),
+			*ParentName,
+			*InSnapshot.GetString(InObject.NameIndex));
+	}
+
+	static FSubsystemSnapshotObjectDiff MakeObjectDiff(const FSubsystemSnapshot& InSnapshot, const FSubsystemSnapshotObject& InObject, ESubsystemSnapshotChange InChange)
+	{
+		FSubsystemSnapshotObjectDiff Result;
+		Result.Category = InSnapshot.GetString(InObject.CategoryIndex);
+		Result.ClassPath = InSnapshot.GetString(InObject.ClassIndex);
+		Result.Name = InSnapshot.GetString(InObject.NameIndex);
+		if (InSnapshot.Objects.IsValidIndex(InObject.ParentIndex))
+		{
+			Result.ParentName = InSnapshot.GetString(InSnapshot.Objects[InObject.ParentIndex].NameIndex);
+		}
+		Result.Change = InChange;
+		return Result;
+	}
+
+	static void DiffProperties(const FSubsystemSnapshot& InBase, const FSubsystemSnapshotObject& InBaseObject,
+		const FSubsystemSnapshot& InTarget, const FSubsystemSnapshotObject& InTargetObject,
+		TArray<FSubsystemSnapshotPropertyDiff>& OutProperties)
+	{
+		TMap<FString, const FSubsystemSnapshotProperty*> TargetByPath;
+		TargetByPath.Reserve(InTargetObject.Properties.Num());
+		for (const FSubsystemSnapshotProperty& Property : InTargetObject.Properties)
+		{
+			TargetByPath.Add(InTarget.GetString(Property.PathIndex), &Property);
+		}
+
+		for (const FSubsystemSnapshotProperty& BaseProperty : InBaseObject.Properties)
+		{
+			const FString& Path = InBase.GetString(BaseProperty.PathIndex);
+
+			const FSubsystemSnapshotProperty* TargetProperty = nullptr;
+			if (!TargetByPath.RemoveAndCopyValue(Path, TargetProperty))
+			{
+				FSubsystemSnapshotPropertyDiff& Diff = OutProperties.AddDefaulted_GetRef();
+				Diff.Path = Path;
+				Diff.BaseValue = InBase.GetString(BaseProperty.ValueIndex);
+				Diff.Change = ESubsystemSnapshotChange::Removed;
+				continue;
+			}
+
+			if (BaseProperty.Hash == TargetProperty->Hash)
+			{
+				continue;
+			}
+
+			FSubsystemSnapshotPropertyDiff& Diff = OutProperties.AddDefaulted_GetRef();
+			Diff.Path = Path;
+			Diff.BaseValue = InBase.GetString(BaseProperty.ValueIndex);
+			Diff.TargetValue = InTarget.GetString(TargetProperty->ValueIndex);
+			Diff.Change = ESubsystemSnapshotChange::Modified;
+		}
+
+		// whatever remains only exists in target
+		for (const FSubsystemSnapshotProperty& TargetProperty : InTargetObject.Properties)
+		{
+			const FString& Path = InTarget.GetString(TargetProperty.PathIndex);
+			if (TargetByPath.Contains(Path))
+			{
+				FSubsystemSnapshotPropertyDiff& Diff = OutProperties.AddDefaulted_GetRef();
+				Diff.Path = Path;
+				Diff.TargetValue = InTarget.GetString(TargetProperty.ValueIndex);
+				Diff.Change = ESubsystemSnapshotChange::Added;
+			}
+		}
+	}
+}
+
+FSubsystemSnapshotDiff FSubsystemSnapshotDiff::Compute(const FSubsystemSnapshot& InBase, const FSubsystemSnapshot& InTarget)
+{
+	SB_TRACE_SCOPE(FSubsystemSnapshotDiff::Compute);
+
+	using namespace SubsystemSnapshotDiff;
+
+	FSubsystemSnapshotDiff Result;
+
+	TMap<FString, int32> TargetByKey;
+	TargetByKey.Reserve(InTarget.Objects.Num());
+	for (int32 Idx = 0; Idx < InTarget.Objects.Num(); ++Idx)
+	{
+		TargetByKey.Add(MakeObjectKey(InTarget, InTarget.Objects[Idx]), Idx);
+	}
+
+	for (const FSubsystemSnapshotObject& BaseObject : InBase.Objects)
+	{
+		int32 TargetIndex = INDEX_NONE;
+		if (!TargetByKey.RemoveAndCopyValue(MakeObjectKey(InBase, BaseObject), TargetIndex))
+		{
+			Result.Objects.Add(MakeObjectDiff(InBase, BaseObject, ESubsystemSnapshotChange::Removed));
+			continue;
+		}
+
+		const FSubsystemSnapshotObject& TargetObject = InTarget.Objects[TargetIndex];
+		if (BaseObject.Hash == TargetObject.Hash)
+		{
+			++Result.NumUnchanged;
+			continue;
+		}
+
+		FSubsystemSnapshotObjectDiff Diff = MakeObjectDiff(InBase, BaseObject, ESubsystemSnapshotChange::Modified);
+		DiffProperties(InBase, BaseObject, InTarget, TargetObject, Diff.Properties);
+
+		if (Diff.Properties.Num())
+		{
+			Result.Objects.Add(MoveTemp(Diff));
+		}
+		else
+		{
+			++Result.NumUnchanged;
+		}
+	}
+
+	// keep target order for added objects
+	for (int32 Idx = 0; Idx < InTarget.Objects.Num(); ++Idx)
+	{
+		if (TargetByKey.Contains(MakeObjectKey(InTarget, InTarget.Objects[Idx])))
+		{
+			Result.Objects.Add(MakeObjectDiff(InTarget, InTarget.Objects[Idx], ESubsystemSnapshotChange::Added));
+		}
+	}
+
+	return Result;
+}
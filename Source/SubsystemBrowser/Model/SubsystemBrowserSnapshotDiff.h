@@ -0,0 +1,57 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSubsystemSnapshot;
+
+enum class ESubsystemSnapshotChange : uint8
+{
+	Added,
+	Removed,
+	Modified
+};
+
+/**
+ * Difference of a single property between two snapshots
+ */
+struct FSubsystemSnapshotPropertyDiff
+{
+	FString Path;
+	FString BaseValue;
+	FString TargetValue;
+	ESubsystemSnapshotChange Change = ESubsystemSnapshotChange::Modified;
+};
+
+/**
+ * Difference of a single subsystem or subobject between two snapshots
+ */
+struct FSubsystemSnapshotObjectDiff
+{
+	FString Category;
+	FString ClassPath;
+	FString Name;
+	/* name of owning subsystem for subobjects */
+	FString ParentName;
+	ESubsystemSnapshotChange Change = ESubsystemSnapshotChange::Modified;
+
+	/* changed properties, empty for added or removed objects */
+	TArray<FSubsystemSnapshotPropertyDiff> Properties;
+};
+
+/**
+ * Comparison of two subsystem snapshots.
+ *
+ * Objects are matched by category, class, owner and name. Object and property hashes are compared first,
+ * values are only read for properties which hashes differ.
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemSnapshotDiff
+{
+	TArray<FSubsystemSnapshotObjectDiff> Objects;
+
+	/* number of matched objects skipped because their hashes were equal */
+	int32 NumUnchanged = 0;
+
+	static FSubsystemSnapshotDiff Compute(const FSubsystemSnapshot& InBase, const FSubsystemSnapshot& InTarget);
+};
@@ -0,0 +1,308 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserTickStats.h"
+
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/ScopeLock.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "UObject/UObjectHash.h"
+#if STATS
+#include "Async/TaskGraphInterfaces.h"
+#include "Stats/StatsData.h"
+#endif
+
+namespace SubsystemTickStats
+{
+	/* seconds after which ticking instances of class are gathered again */
+	static constexpr double InstancesRefreshInterval = 1.0;
+	/* seconds between frames which stats are read, walking aggregated stack of every frame is too costly */
+	static constexpr double SampleInterval = 0.1;
+
+#if STATS
+	static void RunOnStatsThread(TUniqueFunction<void()>&& InFunction)
+	{
+		FFunctionGraphTask::CreateAndDispatchWhenReady(MoveTemp(InFunction), TStatId(), nullptr,
+			FPlatformProcess::SupportsMultithreading() ? ENamedThreads::StatsThread : ENamedThreads::GameThread);
+	}
+#endif
+}
+
+struct FSubsystemTickStats::FState : public TSharedFromThis<FState, ESPMode::ThreadSafe>
+{
+	struct FHistory
+	{
+		float Samples[NumSamples];
+		int32 Head = 0;
+		int32 Num = 0;
+		int64 LastSample = 0;
+	};
+
+	/* guards everything below, histories are written on stats thread and read on game thread */
+	mutable FCriticalSection Lock;
+	TMap<FName, FHistory> Histories;
+	/* number of frames sampled so far */
+	int64 NumSampledFrames = 0;
+
+	/* accessed only on stats thread */
+	FDelegateHandle NewFrameHandle;
+	double LastSampleTime = 0.0;
+
+#if STATS
+	void HandleNewFrame(int64 Frame)
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now - LastSampleTime < SubsystemTickStats::SampleInterval)
+			return;
+
+		LastSampleTime = Now;
+
+		struct FTickablesFilter : public IItemFilter
+		{
+			const FName GroupName = TEXT("STATGROUP_Tickables");
+
+			virtual bool Keep(const FStatMessage& Item) override
+			{
+				return Item.NameAndInfo.GetGroupName() == GroupName;
+			}
+		};
+
+		FTickablesFilter Filter;
+		TArray<FStatMessage> Messages;
+		FStatsThreadState::GetLocalState().GetInclusiveAggregateStackStats(Frame, Messages, &Filter, false);
+
+		FScopeLock ScopeLock(&Lock);
+		++NumSampledFrames;
+
+		for (const FStatMessage& Message : Messages)
+		{
+			if (!Message.NameAndInfo.GetFlag(EStatMetaFlags::IsPackedCCAndDuration))
+				continue;
+
+			const uint32 Cycles = FromPackedCallCountDuration_Duration(Message.GetValue_int64());
+
+			FHistory& History = Histories.FindOrAdd(Message.NameAndInfo.GetShortName());
+			History.Samples[History.Head] = FPlatformTime::ToMilliseconds(Cycles);
+			History.Head = (History.Head + 1) % NumSamples;
+			History.Num = FMath::Min(History.Num + 1, NumSamples);
+			History.LastSample = NumSampledFrames;
+		}
+	}
+#endif
+
+	bool GetInfo(FName InStatName, FSubsystemTickInfo& OutInfo) const
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		// objects that stopped ticking long ago are not reported with outdated values
+		const FHistory* History = Histories.Find(InStatName);
+		if (!History || !History->Num || NumSampledFrames - History->LastSample > NumSamples)
+		{
+			return false;
+		}
+
+		float Total = 0.f;
+		OutInfo.MaxMs = 0.f;
+		for (int32 Idx = 0; Idx < History->Num; ++Idx)
+		{
+			Total += History->Samples[Idx];
+			OutInfo.MaxMs = FMath::Max(OutInfo.MaxMs, History->Samples[Idx]);
+		}
+
+		OutInfo.LastMs = History->Samples[(History->Head + NumSamples - 1) % NumSamples];
+		OutInfo.AverageMs = Total / History->Num;
+		OutInfo.NumFrames = History->Num;
+		return true;
+	}
+};
+
+FSubsystemTickStats::FSubsystemTickStats()
+	: State(MakeShared<FState, ESPMode::ThreadSafe>())
+{
+}
+
+FSubsystemTickStats::~FSubsystemTickStats()
+{
+	Reset();
+}
+
+TOptional<FSubsystemTickInfo> FSubsystemTickStats::Find(const UObject* InObject)
+{
+	if (!InObject || !bCollecting)
+	{
+		return TOptional<FSubsystemTickInfo>();
+	}
+
+	// objects that do not tick are not listed and never get samples of other instances
+	const FClassInstances& Instances = GetClassInstances(InObject->GetClass());
+	const TPair<TWeakObjectPtr<const UObject>, FName>* Entry = Instances.Instances.FindByPredicate([InObject](const TPair<TWeakObjectPtr<const UObject>, FName>& Instance)
+	{
+		return Instance.Key.Get() == InObject;
+	});
+
+	const FName StatName = Entry ? Entry->Value : NAME_None;
+
+	// samples are per stat, they belong to this instance alone only when no other ticking instance shares it
+	int32 NumSharing = 0;
+	for (const TPair<TWeakObjectPtr<const UObject>, FName>& Instance : Instances.Instances)
+	{
+		NumSharing += Instance.Value == StatName ? 1 : 0;
+	}
+
+	FSubsystemTickInfo Info;
+	if (StatName.IsNone() || !State->GetInfo(StatName, Info))
+	{
+		return TOptional<FSubsystemTickInfo>();
+	}
+
+	Info.NumSharingInstances = NumSharing;
+	return Info;
+}
+
+void FSubsystemTickStats::Reset()
+{
+	if (bCollecting)
+	{
+		StopCollecting();
+	}
+	NumRequests = 0;
+
+	FScopeLock ScopeLock(&State->Lock);
+	State->Histories.Empty();
+	ClassInstances.Empty();
+}
+
+void FSubsystemTickStats::AddRequest()
+{
+	if (NumRequests++ == 0)
+	{
+		StartCollecting();
+	}
+}
+
+void FSubsystemTickStats::RemoveRequest()
+{
+	if (NumRequests > 0 && --NumRequests == 0 && bCollecting)
+	{
+		StopCollecting();
+	}
+}
+
+void FSubsystemTickStats::StartCollecting()
+{
+#if STATS
+	bCollecting = true;
+
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+	StatsMasterEnableAdd();
+#else
+	StatsPrimaryEnableAdd();
+#endif
+
+	SubsystemTickStats::RunOnStatsThread([WeakState = TWeakPtr<FState, ESPMode::ThreadSafe>(State)]()
+	{
+		if (TSharedPtr<FState, ESPMode::ThreadSafe> Pinned = WeakState.Pin())
+		{
+			Pinned->NewFrameHandle = FStatsThreadState::GetLocalState().NewFrameDelegate.AddSP(Pinned.ToSharedRef(), &FState::HandleNewFrame);
+		}
+	});
+#endif
+}
+
+void FSubsystemTickStats::StopCollecting()
+{
+#if STATS
+	bCollecting = false;
+
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+	StatsMasterEnableSubtract();
+#else
+	StatsPrimaryEnableSubtract();
+#endif
+
+	SubsystemTickStats::RunOnStatsThread([WeakState = TWeakPtr<FState, ESPMode::ThreadSafe>(State)]()
+	{
+		if (TSharedPtr<FState, ESPMode::ThreadSafe> Pinned = WeakState.Pin())
+		{
+			FStatsThreadState::GetLocalState().NewFrameDelegate.Remove(Pinned->NewFrameHandle);
+			Pinned->NewFrameHandle.Reset();
+		}
+	});
+
+	// samples of previous collection would be reported as recent once collection resumes
+	FScopeLock ScopeLock(&State->Lock);
+	State->Histories.Empty();
+#endif
+}
+
+const FSubsystemTickStats::FClassInstances& FSubsystemTickStats::GetClassInstances(const UClass* InClass)
+{
+	FClassInstances& Entry = ClassInstances.FindOrAdd(InClass);
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - Entry.UpdateTime >= SubsystemTickStats::InstancesRefreshInterval)
+	{
+		Entry.UpdateTime = Now;
+		Entry.Instances.Reset();
+
+		TArray<UObject*> Objects;
+		GetObjectsOfClass(InClass, Objects, false, RF_ClassDefaultObject | RF_ArchetypeObject);
+		for (const UObject* Object : Objects)
+		{
+			if (IsValid(Object) && IsTicking(Object))
+			{
+				Entry.Instances.Emplace(Object, GetStatName(Object));
+			}
+		}
+	}
+
+	return Entry;
+}
+
+bool FSubsystemTickStats::IsTicking(const UObject* InObject)
+{
+#if !UE_VERSION_OLDER_THAN(4, 27, 0)
+	if (const UTickableWorldSubsystem* Tickable = Cast<UTickableWorldSubsystem>(InObject))
+	{
+		const FTickableGameObject* TickableObject = Tickable;
+		if (TickableObject->GetTickableTickType() == ETickableTickType::Never || !TickableObject->IsTickable())
+		{
+			return false;
+		}
+
+		// editor world keeps its instances while play worlds run, they tick only when allowed in editor
+		const UWorld* World = Tickable->GetWorld();
+		return World && (World->IsGameWorld() || TickableObject->IsTickableInEditor());
+	}
+#endif
+	// other tickable objects can not be recognized from UObject, they are assumed to tick
+	return true;
+}
+
+FName FSubsystemTickStats::GetStatName(const UObject* InObject)
+{
+	const UClass* Class = InObject->GetClass();
+
+	FName Result;
+#if STATS
+#if !UE_VERSION_OLDER_THAN(4, 27, 0)
+	if (const UTickableWorldSubsystem* Tickable = Cast<UTickableWorldSubsystem>(InObject))
+	{
+		const TStatId StatId = static_cast<const FTickableGameObject*>(Tickable)->GetStatId();
+		if (StatId.IsValidStat())
+		{
+			Result = FStatNameAndInfo::GetShortNameFrom(StatId.GetName());
+		}
+	}
+#endif
+	if (Result.IsNone())
+	{
+		// RETURN_QUICK_DECLARE_CYCLE_STAT(UMySubsystem, STATGROUP_Tickables)
+		Result = FName(*(FString(Class->GetPrefixCPP()) + Class->GetName()));
+	}
+#endif
+
+	return Result;
+}
@@ -0,0 +1,83 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/WeakObjectPtr.h"
+
+/**
+ * Tick cost of an object over recently sampled frames
+ */
+struct FSubsystemTickInfo
+{
+	float LastMs = 0.f;
+	float AverageMs = 0.f;
+	float MaxMs = 0.f;
+	/* number of frames the values are calculated from */
+	int32 NumFrames = 0;
+	/* number of ticking instances that report into the same stat, values are their sum when above one */
+	int32 NumSharingInstances = 1;
+};
+
+/**
+ * Tick cost sampler of tickable subsystems.
+ *
+ * Relies on cycle stats that engine records around every FTickableGameObject tick: while collection is requested
+ * stats thread copies times of STATGROUP_Tickables entries of a frame into a fixed-size ring buffer per stat.
+ * Only one frame per sample interval is read, so values describe sampled frames rather than every frame.
+ * Collecting enables the whole stats system, which adds measurable overhead to every stat scope of the editor
+ * and all play worlds, so it runs only while something requested it, e.g. while the tick column is displayed.
+ *
+ * Every instance is matched by its own UTickableWorldSubsystem::GetStatId or by class name, which is what
+ * RETURN_QUICK_DECLARE_CYCLE_STAT produces for other FTickableGameObject based subsystems. Engine records
+ * no instance in stats, so instances that do not tick report nothing and values of ticking instances that
+ * share a stat (e.g. same subsystem in several PIE clients) are reported as their sum with number of sharers.
+ * Nothing is collected in builds without STATS.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemTickStats
+{
+public:
+	/* number of sampled frames kept per stat */
+	static constexpr int32 NumSamples = 120;
+
+	FSubsystemTickStats();
+	~FSubsystemTickStats();
+
+	/* get tick cost of object from collected samples */
+	TOptional<FSubsystemTickInfo> Find(const UObject* InObject);
+	/* stop collection and drop all samples */
+	void Reset();
+
+	/* request collection, it runs while there is at least one request */
+	void AddRequest();
+	/* release request added with AddRequest */
+	void RemoveRequest();
+
+	bool IsCollecting() const { return bCollecting; }
+
+	/* does object tick in its world at all */
+	static bool IsTicking(const UObject* InObject);
+	/* name of stat object ticks under, none when unknown */
+	static FName GetStatName(const UObject* InObject);
+
+private:
+	void StartCollecting();
+	void StopCollecting();
+
+	/* ticking instances of class with their stat names */
+	struct FClassInstances
+	{
+		TArray<TPair<TWeakObjectPtr<const UObject>, FName>> Instances;
+		double UpdateTime = 0.0;
+	};
+	const FClassInstances& GetClassInstances(const UClass* InClass);
+
+	struct FState;
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+
+	TMap<TWeakObjectPtr<const UClass>, FClassInstances> ClassInstances;
+
+	int32 NumRequests = 0;
+	bool bCollecting = false;
+};
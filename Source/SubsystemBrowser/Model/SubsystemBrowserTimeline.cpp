@@ -0,0 +1,473 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserTimeline.h"
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserSettings.h"
+#include "SubsystemBrowserTrace.h"
+#include "Model/SubsystemBrowserChangeSampler.h"
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/Paths.h"
+#include "Serialization/BufferReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UnrealType.h"
+
+namespace SubsystemTimeline
+{
+	/* 'SBTL' */
+	static constexpr uint32 FileMagic = 0x4C544253;
+	static constexpr int32 FileVersion = 1;
+
+	/* frame, keyframe flag and body size */
+	static constexpr int64 PassHeaderSize = sizeof(uint64) + sizeof(uint8) + sizeof(int32);
+
+	struct FPassHeader
+	{
+		uint64 Frame = 0;
+		uint8 bKeyframe = 0;
+		int32 Size = 0;
+
+		friend FArchive& operator<<(FArchive& Ar, FPassHeader& Header)
+		{
+			return Ar << Header.Frame << Header.bKeyframe << Header.Size;
+		}
+	};
+
+	static void ExportValue(const FProperty* InProperty, const uint8* InValuePtr, UObject* InOwner, FString& OutValue)
+	{
+		OutValue.Reset();
+#if UE_VERSION_OLDER_THAN(5,1,0)
+		InProperty->ExportTextItem(OutValue, InValuePtr, nullptr, InOwner, PPF_None);
+#else
+		InProperty->ExportTextItem_Direct(OutValue, InValuePtr, nullptr, InOwner, PPF_None);
+#endif
+	}
+}
+
+FSubsystemTimelineRecorder::~FSubsystemTimelineRecorder()
+{
+	Stop();
+}
+
+bool FSubsystemTimelineRecorder::Start(const FString& InFilePath, const FString& InWorldName, const TArray<UObject*>& InObjects)
+{
+	using namespace SubsystemTimeline;
+
+	Stop();
+
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*InFilePath, FILEWRITE_AllowRead));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(LogSubsystemBrowser, Error, TEXT("Failed to open timeline file %s"), *InFilePath);
+		return false;
+	}
+
+	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
+	FrameInterval = Settings->GetTimelineFrameInterval();
+	KeyframeInterval = Settings->GetTimelineKeyframeInterval();
+	BudgetSeconds = Settings->GetTimelineFrameBudget();
+
+	FilePath = InFilePath;
+	Objects.Reset();
+	Cursor = INDEX_NONE;
+	FramesToNextPass = 0;
+	NumPasses = 0;
+
+	uint32 Magic = FileMagic;
+	int32 Version = FileVersion;
+	FString WorldName = InWorldName;
+	int32 NumObjects = 0;
+
+	for (UObject* Object : InObjects)
+	{
+		NumObjects += IsValid(Object) ? 1 : 0;
+	}
+
+	*Writer << Magic << Version << WorldName << NumObjects;
+
+	for (UObject* Object : InObjects)
+	{
+		if (!IsValid(Object))
+			continue;
+
+		FRecordedObject& Record = Objects.AddDefaulted_GetRef();
+		Record.Object = Object;
+
+		FSubsystemTimelineObjectInfo Info;
+		Info.ClassPath = Object->GetClass()->GetPathName();
+		Info.Name = Object->GetName();
+
+		for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+		{
+			FProperty* Property = *It;
+			if (Property->HasAnyPropertyFlags(CPF_Deprecated))
+				continue;
+
+			for (int32 Idx = 0; Idx < Property->ArrayDim; Idx++)
+			{
+				FRecordedProperty& RecordedProperty = Record.Properties.AddDefaulted_GetRef();
+				RecordedProperty.Property = Property;
+				RecordedProperty.ArrayIndex = Idx;
+
+				Info.PropertyPaths.Add(Property->ArrayDim > 1 ? FString::Printf(TEXT("%s[%d]"), *Property->GetName(), Idx) : Property->GetName());
+			}
+		}
+
+		*Writer << Info.ClassPath << Info.Name << Info.PropertyPaths;
+	}
+
+	Writer->Flush();
+
+	PassBuffer.Reset();
+	PassWriter = MakeUnique<FMemoryWriter>(PassBuffer);
+
+	TickerHandle = FTickerHelper::AddTicker(FTickerDelegate::CreateRaw(this, &FSubsystemTimelineRecorder::HandleTick));
+
+	UE_LOG(LogSubsystemBrowser, Log, TEXT("Started timeline recording of %d objects to %s"), Objects.Num(), *FilePath);
+	return true;
+}
+
+void FSubsystemTimelineRecorder::Stop()
+{
+	FTickerHelper::RemoveTicker(TickerHandle);
+
+	if (Writer.IsValid())
+	{
+		// pass in progress is dropped, reader would ignore it anyway
+		Writer->Close();
+		Writer.Reset();
+
+		UE_LOG(LogSubsystemBrowser, Log, TEXT("Stopped timeline recording to %s after %d passes"), *FilePath, NumPasses);
+	}
+
+	PassWriter.Reset();
+	PassBuffer.Empty();
+	Objects.Empty();
+	Cursor = INDEX_NONE;
+}
+
+int64 FSubsystemTimelineRecorder::GetNumBytesWritten() const
+{
+	return Writer.IsValid() ? Writer->Tell() : 0;
+}
+
+bool FSubsystemTimelineRecorder::HandleTick(float DeltaTime)
+{
+	Tick();
+	return true;
+}
+
+void FSubsystemTimelineRecorder::Tick()
+{
+	if (!Writer.IsValid() || !Objects.Num())
+	{
+		return;
+	}
+
+	if (Cursor == INDEX_NONE)
+	{
+		if (FramesToNextPass > 0)
+		{
+			--FramesToNextPass;
+			return;
+		}
+
+		BeginPass();
+	}
+
+	SB_TRACE_SCOPE(FSubsystemTimelineRecorder::Tick);
+
+	const double StartTime = FPlatformTime::Seconds();
+	do
+	{
+		if (RecordObject(Cursor, StartTime))
+		{
+			++Cursor;
+			PropertyCursor = 0;
+		}
+	}
+	while (Cursor < Objects.Num() && FPlatformTime::Seconds() - StartTime < BudgetSeconds);
+
+	if (Cursor >= Objects.Num())
+	{
+		EndPass();
+	}
+}
+
+void FSubsystemTimelineRecorder::BeginPass()
+{
+	PassFrame = GFrameCounter;
+	bKeyframePass = (NumPasses % KeyframeInterval) == 0;
+
+	PassBuffer.Reset();
+	PassWriter->Seek(0);
+
+	Cursor = 0;
+	PropertyCursor = 0;
+}
+
+bool FSubsystemTimelineRecorder::RecordObject(int32 InObjectIndex, double InStartTime)
+{
+	FRecordedObject& Record = Objects[InObjectIndex];
+
+	if (PropertyCursor == 0)
+	{
+		ChangedProperties.Reset();
+		ChangedValues.Reset();
+	}
+
+	UObject* Object = Record.Object.Get();
+	if (!Object)
+	{
+		return true;
+	}
+
+	// large objects are split between frames, changed values are exported as soon as they are found
+	// so that values written for a pass are the ones that were hashed
+	while (PropertyCursor < Record.Properties.Num())
+	{
+		const int32 Idx = PropertyCursor++;
+		FRecordedProperty& RecordedProperty = Record.Properties[Idx];
+
+		const uint8* ValuePtr = RecordedProperty.Property->ContainerPtrToValuePtr<uint8>(Object, RecordedProperty.ArrayIndex);
+		const uint32 Hash = FSubsystemChangeSampler::HashPropertyValue(RecordedProperty.Property, ValuePtr, Object, ValueBuffer);
+		if (bKeyframePass || Hash != RecordedProperty.Hash)
+		{
+			SubsystemTimeline::ExportValue(RecordedProperty.Property, ValuePtr, Object, ValueBuffer);
+			ChangedProperties.Add(Idx);
+			ChangedValues.Add(ValueBuffer);
+		}
+		RecordedProperty.Hash = Hash;
+
+		if (PropertyCursor < Record.Properties.Num() && FPlatformTime::Seconds() - InStartTime >= BudgetSeconds)
+		{
+			return false;
+		}
+	}
+
+	if (!ChangedProperties.Num())
+	{
+		return true;
+	}
+
+	FArchive& Ar = *PassWriter;
+
+	int32 ObjectIndex = InObjectIndex;
+	int32 NumValues = ChangedProperties.Num();
+	Ar << ObjectIndex << NumValues;
+
+	for (int32 Idx = 0; Idx < ChangedProperties.Num(); ++Idx)
+	{
+		Ar << ChangedProperties[Idx] << ChangedValues[Idx];
+	}
+
+	return true;
+}
+
+void FSubsystemTimelineRecorder::EndPass()
+{
+	using namespace SubsystemTimeline;
+
+	if (bKeyframePass || PassBuffer.Num())
+	{
+		FPassHeader Header;
+		Header.Frame = PassFrame;
+		Header.bKeyframe = bKeyframePass ? 1 : 0;
+		Header.Size = PassBuffer.Num();
+
+		*Writer << Header;
+		Writer->Serialize(PassBuffer.GetData(), PassBuffer.Num());
+
+		// make keyframes visible to readers without waiting for writer buffer to fill up
+		if (bKeyframePass)
+		{
+			Writer->Flush();
+		}
+	}
+
+	++NumPasses;
+	Cursor = INDEX_NONE;
+	FramesToNextPass = FrameInterval;
+}
+
+FString FSubsystemTimelineRecorder::GetTimelineDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SubsystemBrowser"), TEXT("Timelines"));
+}
+
+FString FSubsystemTimelineRecorder::MakeDefaultFilePath(const FString& InWorldName)
+{
+	const FString FileName = FString::Printf(TEXT("%s-%s.sbtl"), *InWorldName, *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S-%s")));
+	return FPaths::ConvertRelativePathToFull(FPaths::Combine(GetTimelineDirectory(), FileName));
+}
+
+FSubsystemTimelineReader::~FSubsystemTimelineReader()
+{
+	// region must be released before its file
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+TSharedPtr<FSubsystemTimelineReader> FSubsystemTimelineReader::Open(const FString& InFilePath)
+{
+	using namespace SubsystemTimeline;
+
+	SB_TRACE_SCOPE(FSubsystemTimelineReader::Open);
+
+	TSharedPtr<FSubsystemTimelineReader> Reader = MakeShared<FSubsystemTimelineReader>();
+	Reader->FilePath = InFilePath;
+
+	Reader->MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*InFilePath));
+	if (!Reader->MappedFile.IsValid() || Reader->MappedFile->GetFileSize() <= 0)
+	{
+		UE_LOG(LogSubsystemBrowser, Error, TEXT("Failed to map timeline file %s"), *InFilePath);
+		return nullptr;
+	}
+
+	Reader->MappedRegion.Reset(Reader->MappedFile->MapRegion(0, Reader->MappedFile->GetFileSize()));
+	if (!Reader->MappedRegion.IsValid())
+	{
+		UE_LOG(LogSubsystemBrowser, Error, TEXT("Failed to map timeline file %s"), *InFilePath);
+		return nullptr;
+	}
+
+	const int64 MappedSize = Reader->MappedRegion->GetMappedSize();
+	FBufferReader Ar(const_cast<uint8*>(Reader->MappedRegion->GetMappedPtr()), MappedSize, false);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 NumObjects = 0;
+	Ar << Magic << Version;
+	if (Magic != FileMagic || Version > FileVersion)
+	{
+		UE_LOG(LogSubsystemBrowser, Error, TEXT("Unsupported timeline file %s"), *InFilePath);
+		return nullptr;
+	}
+
+	Ar << Reader->WorldName << NumObjects;
+	for (int32 Idx = 0; Idx < NumObjects && !Ar.IsError(); ++Idx)
+	{
+		FSubsystemTimelineObjectInfo& Info = Reader->Objects.AddDefaulted_GetRef();
+		Ar << Info.ClassPath << Info.Name << Info.PropertyPaths;
+	}
+
+	if (Ar.IsError())
+	{
+		UE_LOG(LogSubsystemBrowser, Error, TEXT("Corrupted timeline file %s"), *InFilePath);
+		return nullptr;
+	}
+
+	// only headers are read here, bodies are skipped
+	bool bHasPasses = false;
+	while (Ar.Tell() + PassHeaderSize <= MappedSize)
+	{
+		const int64 Offset = Ar.Tell();
+
+		FPassHeader Header;
+		Ar << Header;
+		if (Header.Size < 0 || Ar.Tell() + Header.Size > MappedSize)
+		{
+			break;
+		}
+
+		if (Header.bKeyframe)
+		{
+			Reader->Keyframes.Add({ Header.Frame, Offset });
+		}
+
+		Reader->FirstFrame = bHasPasses ? Reader->FirstFrame : Header.Frame;
+		Reader->LastFrame = Header.Frame;
+		bHasPasses = true;
+
+		Ar.Seek(Ar.Tell() + Header.Size);
+	}
+
+	return Reader;
+}
+
+int32 FSubsystemTimelineReader::FindObject(const FString& InClassPath, const FString& InName) const
+{
+	const int32 Index = Objects.IndexOfByPredicate([&InClassPath, &InName](const FSubsystemTimelineObjectInfo& Info)
+	{
+		return Info.ClassPath == InClassPath && Info.Name == InName;
+	});
+	if (Index != INDEX_NONE)
+	{
+		return Index;
+	}
+
+	// instance names differ between play sessions
+	return Objects.IndexOfByPredicate([&InClassPath](const FSubsystemTimelineObjectInfo& Info)
+	{
+		return Info.ClassPath == InClassPath;
+	});
+}
+
+bool FSubsystemTimelineReader::GetObjectState(int32 InObjectIndex, uint64 InFrame, TArray<TOptional<FString>>& OutValues) const
+{
+	using namespace SubsystemTimeline;
+
+	SB_TRACE_SCOPE(FSubsystemTimelineReader::GetObjectState);
+
+	if (!Objects.IsValidIndex(InObjectIndex) || !Keyframes.Num())
+	{
+		return false;
+	}
+
+	// closest keyframe at or before requested frame
+	const int32 KeyframeIndex = Algo::UpperBoundBy(Keyframes, InFrame, &FKeyframe::Frame) - 1;
+	if (KeyframeIndex < 0)
+	{
+		return false;
+	}
+
+	OutValues.Reset();
+	OutValues.SetNum(Objects[InObjectIndex].PropertyPaths.Num());
+
+	const int64 MappedSize = MappedRegion->GetMappedSize();
+	FBufferReader Ar(const_cast<uint8*>(MappedRegion->GetMappedPtr()), MappedSize, false);
+	Ar.Seek(Keyframes[KeyframeIndex].Offset);
+
+	bool bFound = false;
+	FString Value;
+
+	while (Ar.Tell() + PassHeaderSize <= MappedSize)
+	{
+		FPassHeader Header;
+		Ar << Header;
+		if (Header.Frame > InFrame || Header.Size < 0 || Ar.Tell() + Header.Size > MappedSize)
+		{
+			break;
+		}
+
+		const int64 PassEnd = Ar.Tell() + Header.Size;
+		while (Ar.Tell() < PassEnd && !Ar.IsError())
+		{
+			int32 ObjectIndex = INDEX_NONE;
+			int32 NumValues = 0;
+			Ar << ObjectIndex << NumValues;
+
+			for (int32 Idx = 0; Idx < NumValues && !Ar.IsError(); ++Idx)
+			{
+				int32 PropertyIndex = INDEX_NONE;
+				Ar << PropertyIndex << Value;
+
+				if (ObjectIndex == InObjectIndex && OutValues.IsValidIndex(PropertyIndex))
+				{
+					OutValues[PropertyIndex] = Value;
+					bFound = true;
+				}
+			}
+		}
+
+		Ar.Seek(PassEnd);
+	}
+
+	return bFound;
+}
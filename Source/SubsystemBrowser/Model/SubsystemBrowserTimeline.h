@@ -0,0 +1,149 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SubsystemBrowserTicker.h"
+#include "UObject/WeakObjectPtr.h"
+
+class FArchive;
+class FProperty;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Recorded object and its property table as stored in timeline header
+ */
+struct FSubsystemTimelineObjectInfo
+{
+	FString ClassPath;
+	FString Name;
+	/* property paths, static array elements are recorded separately */
+	TArray<FString> PropertyPaths;
+};
+
+/**
+ * Records reflected state of a fixed set of objects into an append-only timeline file.
+ *
+ * Each pass visits all objects once, spreading work over several frames within a time budget
+ * that is checked between properties, so a single large object may span several frames.
+ * Passes are separated by a configured number of frames. Every Nth pass is a keyframe that stores all values,
+ * other passes only store values whose hash changed since previous pass.
+ * Passes are written through a buffered file writer, so only hashes of last pass are kept in memory.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemTimelineRecorder
+{
+public:
+	FSubsystemTimelineRecorder() = default;
+	~FSubsystemTimelineRecorder();
+
+	bool Start(const FString& InFilePath, const FString& InWorldName, const TArray<UObject*>& InObjects);
+	void Stop();
+
+	bool IsRecording() const { return Writer.IsValid(); }
+	const FString& GetFilePath() const { return FilePath; }
+	int32 GetNumPasses() const { return NumPasses; }
+	int64 GetNumBytesWritten() const;
+
+	/* advance recording by one frame */
+	void Tick();
+
+	/* directory timelines are saved to by default */
+	static FString GetTimelineDirectory();
+	/* generate unique timeline file path within default directory */
+	static FString MakeDefaultFilePath(const FString& InWorldName);
+
+private:
+	bool HandleTick(float DeltaTime);
+	void BeginPass();
+	/* @return true when all properties of object were visited */
+	bool RecordObject(int32 InObjectIndex, double InStartTime);
+	void EndPass();
+
+	struct FRecordedProperty
+	{
+		const FProperty* Property = nullptr;
+		int32 ArrayIndex = 0;
+		uint32 Hash = 0;
+	};
+
+	struct FRecordedObject
+	{
+		TWeakObjectPtr<UObject> Object;
+		TArray<FRecordedProperty> Properties;
+	};
+
+	TArray<FRecordedObject> Objects;
+
+	FString FilePath;
+	TUniquePtr<FArchive> Writer;
+
+	/* serialized content of pass in progress, reused between passes */
+	TArray<uint8> PassBuffer;
+	TUniquePtr<FArchive> PassWriter;
+	/* reused when exporting values */
+	FString ValueBuffer;
+	/* changed properties of object in progress and their exported values */
+	TArray<int32> ChangedProperties;
+	TArray<FString> ChangedValues;
+
+	uint32 FrameInterval = 10;
+	int32 KeyframeInterval = 30;
+	double BudgetSeconds = 0.0001;
+
+	int32 Cursor = INDEX_NONE;
+	/* next property of object at Cursor */
+	int32 PropertyCursor = 0;
+	uint32 FramesToNextPass = 0;
+	uint64 PassFrame = 0;
+	bool bKeyframePass = false;
+	int32 NumPasses = 0;
+
+	FTickerHelper::FHandle TickerHandle;
+};
+
+/**
+ * Reads a timeline file through memory mapping and reconstructs object state at any recorded frame.
+ *
+ * Only pass headers are scanned on open to locate keyframes, values are parsed on request
+ * starting from closest keyframe. Passes that were not completely flushed yet are ignored.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemTimelineReader
+{
+public:
+	~FSubsystemTimelineReader();
+
+	static TSharedPtr<FSubsystemTimelineReader> Open(const FString& InFilePath);
+
+	const FString& GetFilePath() const { return FilePath; }
+	const FString& GetWorldName() const { return WorldName; }
+	const TArray<FSubsystemTimelineObjectInfo>& GetObjects() const { return Objects; }
+	/* find recorded object by class and name, falls back to first object of the class when name does not match */
+	int32 FindObject(const FString& InClassPath, const FString& InName) const;
+
+	uint64 GetFirstFrame() const { return FirstFrame; }
+	uint64 GetLastFrame() const { return LastFrame; }
+
+	/**
+	 * Reconstruct exported values of object as of specified frame.
+	 * Values are indexed by object property table, properties not recorded yet are left unset.
+	 */
+	bool GetObjectState(int32 InObjectIndex, uint64 InFrame, TArray<TOptional<FString>>& OutValues) const;
+
+private:
+	struct FKeyframe
+	{
+		uint64 Frame = 0;
+		int64 Offset = 0;
+	};
+
+	FString FilePath;
+	FString WorldName;
+	TArray<FSubsystemTimelineObjectInfo> Objects;
+	TArray<FKeyframe> Keyframes;
+	uint64 FirstFrame = 0;
+	uint64 LastFrame = 0;
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+};
@@ -0,0 +1,320 @@
+// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserWorldCompare.h"
+
+#include "SubsystemBrowserTrace.h"
+#include "Model/SubsystemBrowserChangeSampler.h"
+#include "Model/SubsystemBrowserModel.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/UnrealType.h"
+
+namespace SubsystemWorldCompare
+{
+	/* does value of property reference objects, struct recursion is limited by already visited structs */
+	static bool HasReferences(const FProperty* InProperty, TArray<const UStruct*>& InVisited)
+	{
+		if (InProperty->IsA<FObjectPropertyBase>() || InProperty->IsA<FInterfaceProperty>()
+			|| InProperty->IsA<FDelegateProperty>() || InProperty->IsA<FMulticastDelegateProperty>())
+		{
+			return true;
+		}
+
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty))
+		{
+			return HasReferences(ArrayProperty->Inner, InVisited);
+		}
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(InProperty))
+		{
+			return HasReferences(SetProperty->ElementProp, InVisited);
+		}
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(InProperty))
+		{
+			return HasReferences(MapProperty->KeyProp, InVisited) || HasReferences(MapProperty->ValueProp, InVisited);
+		}
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty))
+		{
+			if (InVisited.Contains(StructProperty->Struct))
+				return false;
+
+			InVisited.Add(StructProperty->Struct);
+			for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+			{
+				if (HasReferences(*It, InVisited))
+					return true;
+			}
+		}
+		return false;
+	}
+}
+
+FSubsystemClassInfoCache& FSubsystemClassInfoCache::GetShared()
+{
+	static FSubsystemClassInfoCache Instance;
+	return Instance;
+}
+
+TSharedRef<const FSubsystemClassInfo> FSubsystemClassInfoCache::FindOrAdd(const UClass* InClass)
+{
+	if (const TSharedRef<const FSubsystemClassInfo>* Existing = Classes.Find(InClass))
+	{
+		return *Existing;
+	}
+
+	// reinstanced classes leave stale entries behind
+	for (auto It = Classes.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TSharedRef<FSubsystemClassInfo> Info = MakeShared<FSubsystemClassInfo>();
+	for (TFieldIterator<FProperty> It(InClass); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (Property->HasAnyPropertyFlags(CPF_Deprecated))
+			continue;
+
+		TArray<const UStruct*> Visited;
+		const bool bHasNestedReferences = !Property->IsA<FObjectPropertyBase>() && SubsystemWorldCompare::HasReferences(Property, Visited);
+
+		for (int32 Idx = 0; Idx < Property->ArrayDim; Idx++)
+		{
+			FSubsystemClassInfo::FPropertyEntry& Entry = Info->Properties.AddDefaulted_GetRef();
+			Entry.Property = Property;
+			Entry.ArrayIndex = Idx;
+			Entry.Path = Property->ArrayDim > 1 ? FString::Printf(TEXT("%s[%d]"), *Property->GetName(), Idx) : Property->GetName();
+			Entry.bHasNestedReferences = bHasNestedReferences;
+		}
+	}
+
+	Classes.Add(InClass, Info);
+	return Info;
+}
+
+bool FSubsystemWorldCompareRow::IsValueDifferent(int32 InWorldIndex, int32 InPropertyIndex) const
+{
+	if (!IsPropertyDifferent(InPropertyIndex) || !Instances.IsValidIndex(InWorldIndex) || !Instances[InWorldIndex].IsValid())
+	{
+		return false;
+	}
+
+	const int32 NumWorlds = Instances.Num();
+	for (int32 WorldIndex = 0; WorldIndex < NumWorlds; ++WorldIndex)
+	{
+		if (Instances[WorldIndex].IsValid())
+		{
+			return Hashes[InPropertyIndex * NumWorlds + WorldIndex] != Hashes[InPropertyIndex * NumWorlds + InWorldIndex];
+		}
+	}
+	return false;
+}
+
+void FSubsystemWorldCompareRow::ExportValue(int32 InWorldIndex, int32 InPropertyIndex, FString& OutValue) const
+{
+	OutValue.Reset();
+
+	UObject* Object = Instances.IsValidIndex(InWorldIndex) ? Instances[InWorldIndex].Get() : nullptr;
+	if (!Object || !ClassInfo.IsValid() || !ClassInfo->Properties.IsValidIndex(InPropertyIndex))
+	{
+		return;
+	}
+
+	const FSubsystemClassInfo::FPropertyEntry& Entry = ClassInfo->Properties[InPropertyIndex];
+	const uint8* ValuePtr = Entry.Property->ContainerPtrToValuePtr<uint8>(Object, Entry.ArrayIndex);
+#if UE_VERSION_OLDER_THAN(5,1,0)
+	Entry.Property->ExportTextItem(OutValue, ValuePtr, nullptr, Object, PPF_None);
+#else
+	Entry.Property->ExportTextItem_Direct(OutValue, ValuePtr, nullptr, Object, PPF_None);
+#endif
+}
+
+void FSubsystemWorldComparison::SetWorlds(const TArray<TWeakObjectPtr<UWorld>>& InWorlds)
+{
+	Worlds = InWorlds;
+	Rebuild();
+}
+
+bool FSubsystemWorldComparison::HasStaleWorlds() const
+{
+	return Worlds.ContainsByPredicate([](const TWeakObjectPtr<UWorld>& World) { return !World.IsValid(); });
+}
+
+void FSubsystemWorldComparison::Rebuild()
+{
+	SB_TRACE_SCOPE(FSubsystemWorldComparison::Rebuild);
+
+	Rows.Reset();
+	RowCursor = INDEX_NONE;
+
+	FSubsystemClassInfoCache& ClassInfoCache = FSubsystemClassInfoCache::GetShared();
+
+	TMap<const UClass*, TSharedRef<FSubsystemWorldCompareRow>> RowsByClass;
+	for (int32 WorldIndex = 0; WorldIndex < Worlds.Num(); ++WorldIndex)
+	{
+		if (!Worlds[WorldIndex].IsValid())
+			continue;
+
+		TSharedRef<FSubsystemModel> Model = MakeShared<FSubsystemModel>();
+		Model->SetCurrentWorld(Worlds[WorldIndex]);
+
+		for (const SubsystemTreeItemPtr& Item : Model->GetAllSubsystems())
+		{
+			UObject* const Object = Item->GetObjectForDetails();
+			if (!IsValid(Object))
+				continue;
+
+			UClass* const Class = Object->GetClass();
+
+			TSharedRef<FSubsystemWorldCompareRow>* RowPtr = RowsByClass.Find(Class);
+			if (!RowPtr)
+			{
+				TSharedRef<FSubsystemWorldCompareRow> NewRow = MakeShared<FSubsystemWorldCompareRow>();
+				NewRow->Class = Class;
+				NewRow->DisplayName = Item->GetDisplayName();
+				NewRow->Category = Item->GetParent().IsValid() ? Item->GetParent()->GetDisplayName() : FText::GetEmpty();
+				NewRow->ClassInfo = ClassInfoCache.FindOrAdd(Class);
+				NewRow->Instances.SetNum(Worlds.Num());
+
+				RowPtr = &RowsByClass.Add(Class, NewRow);
+				Rows.Add(NewRow);
+			}
+
+			// multiple instances per world (e.g. local players) are compared by first one
+			if (!(*RowPtr)->Instances[WorldIndex].IsValid())
+			{
+				(*RowPtr)->Instances[WorldIndex] = Object;
+			}
+		}
+	}
+
+	Rows.Sort([](const TSharedRef<FSubsystemWorldCompareRow>& A, const TSharedRef<FSubsystemWorldCompareRow>& B)
+	{
+		const int32 CategoryResult = A->Category.CompareTo(B->Category);
+		return CategoryResult != 0 ? CategoryResult < 0 : A->DisplayName.CompareTo(B->DisplayName) < 0;
+	});
+
+	BeginUpdate();
+}
+
+bool FSubsystemWorldComparison::TickUpdate(double InBudgetSeconds)
+{
+	if (!IsUpdateInProgress())
+	{
+		return false;
+	}
+
+	SB_TRACE_SCOPE(FSubsystemWorldComparison::TickUpdate);
+
+	// rows are hashed whole so differences of a row are always from same frame
+	const double StartTime = FPlatformTime::Seconds();
+	while (RowCursor < Rows.Num())
+	{
+		UpdateRowHashes(*Rows[RowCursor++], Scratch);
+
+		if (FPlatformTime::Seconds() - StartTime >= InBudgetSeconds)
+			break;
+	}
+
+	if (RowCursor >= Rows.Num())
+	{
+		RowCursor = INDEX_NONE;
+		return true;
+	}
+	return false;
+}
+
+int32 FSubsystemWorldComparison::GetNumDifferentRows() const
+{
+	int32 Result = 0;
+	for (const TSharedRef<FSubsystemWorldCompareRow>& Row : Rows)
+	{
+		Result += Row->IsDifferent() ? 1 : 0;
+	}
+	return Result;
+}
+
+void FSubsystemWorldComparison::UpdateRowHashes(FSubsystemWorldCompareRow& InRow, FString& InScratch) const
+{
+	const int32 NumWorlds = InRow.Instances.Num();
+	const int32 NumProperties = InRow.GetNumProperties();
+
+	InRow.Hashes.SetNumZeroed(NumProperties * NumWorlds);
+	InRow.DifferentProperties.Init(false, NumProperties);
+	InRow.NumDifferentProperties = 0;
+	InRow.bMissingInstances = false;
+
+	for (int32 WorldIndex = 0; WorldIndex < NumWorlds; ++WorldIndex)
+	{
+		// world itself may be gone, such slots are neither missing nor compared
+		const UObject* Object = InRow.Instances[WorldIndex].Get();
+		if (!Object)
+		{
+			InRow.bMissingInstances |= Worlds.IsValidIndex(WorldIndex) && Worlds[WorldIndex].IsValid();
+			continue;
+		}
+
+		for (int32 PropertyIndex = 0; PropertyIndex < NumProperties; ++PropertyIndex)
+		{
+			const FSubsystemClassInfo::FPropertyEntry& Entry = InRow.ClassInfo->Properties[PropertyIndex];
+			const uint8* ValuePtr = Entry.Property->ContainerPtrToValuePtr<uint8>(Object, Entry.ArrayIndex);
+			InRow.Hashes[PropertyIndex * NumWorlds + WorldIndex] = HashComparableValue(Entry, ValuePtr, Object, InScratch);
+		}
+	}
+
+	for (int32 PropertyIndex = 0; PropertyIndex < NumProperties; ++PropertyIndex)
+	{
+		const uint32* PropertyHashes = &InRow.Hashes[PropertyIndex * NumWorlds];
+
+		TOptional<uint32> FirstHash;
+		for (int32 WorldIndex = 0; WorldIndex < NumWorlds; ++WorldIndex)
+		{
+			if (!InRow.Instances[WorldIndex].IsValid())
+				continue;
+
+			if (!FirstHash.IsSet())
+			{
+				FirstHash = PropertyHashes[WorldIndex];
+			}
+			else if (FirstHash.GetValue() != PropertyHashes[WorldIndex])
+			{
+				InRow.DifferentProperties[PropertyIndex] = true;
+				InRow.NumDifferentProperties++;
+				break;
+			}
+		}
+	}
+}
+
+uint32 FSubsystemWorldComparison::HashComparableValue(const FSubsystemClassInfo::FPropertyEntry& InEntry, const uint8* InValuePtr, const UObject* InOwner, FString& InScratch)
+{
+	const FProperty* InProperty = InEntry.Property;
+
+	// same object in different worlds never shares an address, compare by name instead
+	if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(InProperty))
+	{
+		const UObject* Value = ObjectProperty->GetObjectPropertyValue(InValuePtr);
+		return Value ? HashCombine(GetTypeHash(Value->GetFName()), GetTypeHash(Value->GetClass())) : 0;
+	}
+
+	if (!InEntry.bHasNestedReferences)
+	{
+		return FSubsystemChangeSampler::HashPropertyValue(InProperty, InValuePtr, InOwner, InScratch);
+	}
+
+	// nested references are exported as paths that include PIE instance prefix
+	InScratch.Reset();
+#if UE_VERSION_OLDER_THAN(5,1,0)
+	InProperty->ExportTextItem(InScratch, InValuePtr, nullptr, const_cast<UObject*>(InOwner), PPF_None);
+#else
+	InProperty->ExportTextItem_Direct(InScratch, InValuePtr, nullptr, const_cast<UObject*>(InOwner), PPF_None);
+#endif
+	if (InScratch.Contains(TEXT("UEDPIE_")))
+	{
+		InScratch = UWorld::RemovePIEPrefix(InScratch);
+	}
+	return FCrc::StrCrc32(*InScratch);
+}
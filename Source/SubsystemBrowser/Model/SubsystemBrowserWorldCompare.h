@@ -0,0 +1,117 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class FProperty;
+class UWorld;
+
+/**
+ * Reflected properties of a class flattened into a list, static array elements are listed separately
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemClassInfo
+{
+	struct FPropertyEntry
+	{
+		const FProperty* Property = nullptr;
+		int32 ArrayIndex = 0;
+		FString Path;
+		/* value holds object references below top level, which can not be compared by memory */
+		bool bHasNestedReferences = false;
+	};
+
+	TArray<FPropertyEntry> Properties;
+};
+
+/**
+ * Flattened property lists of classes, shared by all worlds and rows that display same class
+ */
+class SUBSYSTEMBROWSER_API FSubsystemClassInfoCache
+{
+public:
+	static FSubsystemClassInfoCache& GetShared();
+
+	TSharedRef<const FSubsystemClassInfo> FindOrAdd(const UClass* InClass);
+	void Reset() { Classes.Empty(); }
+
+private:
+	TMap<TWeakObjectPtr<const UClass>, TSharedRef<const FSubsystemClassInfo>> Classes;
+};
+
+/**
+ * Single subsystem class with its instance and property hashes in each compared world
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemWorldCompareRow
+{
+	TWeakObjectPtr<UClass> Class;
+	FText DisplayName;
+	FText Category;
+	TSharedPtr<const FSubsystemClassInfo> ClassInfo;
+
+	/* instance per compared world, unset when world has no such subsystem */
+	TArray<TWeakObjectPtr<UObject>> Instances;
+	/* property value hashes, NumProperties x NumWorlds */
+	TArray<uint32> Hashes;
+	/* properties which value is not same in all worlds that have an instance */
+	TBitArray<> DifferentProperties;
+	int32 NumDifferentProperties = 0;
+	bool bMissingInstances = false;
+
+	int32 GetNumProperties() const { return ClassInfo.IsValid() ? ClassInfo->Properties.Num() : 0; }
+	bool IsDifferent() const { return bMissingInstances || NumDifferentProperties > 0; }
+	bool IsPropertyDifferent(int32 InPropertyIndex) const { return DifferentProperties.IsValidIndex(InPropertyIndex) && DifferentProperties[InPropertyIndex]; }
+	/* does value in specified world differ from value in first world that has an instance */
+	bool IsValueDifferent(int32 InWorldIndex, int32 InPropertyIndex) const;
+
+	/* export current property value of instance in specified world, empty when there is no instance */
+	void ExportValue(int32 InWorldIndex, int32 InPropertyIndex, FString& OutValue) const;
+};
+
+/**
+ * Compares reflected state of same subsystems across several worlds.
+ *
+ * Rows are built once per world set, after that only property hashes are recomputed,
+ * row by row in passes that are spread over several frames by a time budget.
+ * Values are hashed by memory, except references to objects that are compared by name and
+ * values with nested references that are compared by exported text without PIE prefix,
+ * so equal state replicated into different PIE worlds is not reported as different.
+ */
+class SUBSYSTEMBROWSER_API FSubsystemWorldComparison
+{
+public:
+	void SetWorlds(const TArray<TWeakObjectPtr<UWorld>>& InWorlds);
+	const TArray<TWeakObjectPtr<UWorld>>& GetWorlds() const { return Worlds; }
+	bool HasStaleWorlds() const;
+
+	/* rebuild rows from subsystems of compared worlds, rows are hashed by following update pass */
+	void Rebuild();
+
+	/* start new pass that rehashes property values of all rows, unfinished pass is restarted */
+	void BeginUpdate() { RowCursor = 0; }
+	bool IsUpdateInProgress() const { return RowCursor != INDEX_NONE; }
+	/**
+	 * Continue rehashing rows and updating difference flags
+	 * @param InBudgetSeconds maximum time to spend hashing during this call, at least one row is hashed
+	 * @return true if pass has finished during this call
+	 */
+	bool TickUpdate(double InBudgetSeconds);
+
+	const TArray<TSharedRef<FSubsystemWorldCompareRow>>& GetRows() const { return Rows; }
+	int32 GetNumDifferentRows() const;
+
+	/* hash of value that is stable across worlds */
+	static uint32 HashComparableValue(const FSubsystemClassInfo::FPropertyEntry& InEntry, const uint8* InValuePtr, const UObject* InOwner, FString& InScratch);
+
+private:
+	void UpdateRowHashes(FSubsystemWorldCompareRow& InRow, FString& InScratch) const;
+
+	TArray<TWeakObjectPtr<UWorld>> Worlds;
+	TArray<TSharedRef<FSubsystemWorldCompareRow>> Rows;
+
+	/* next row to hash in running update pass */
+	int32 RowCursor = INDEX_NONE;
+	/* reused between values to avoid reallocations */
+	FString Scratch;
+};
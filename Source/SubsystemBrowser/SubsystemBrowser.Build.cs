@@ -47,7 +47,19 @@ public class SubsystemBrowser : ModuleRules
 			"ToolMenus",
 			"SettingsEditor",
 			"AssetTools",
-			"Projects"
+			"Projects",
+			"SourceControl",
+			"Json",
+			"DesktopPlatform"
 		});
+
+		// Reading of Unreal Insights traces for profile import, see SB_WITH_TRACE_IMPORT
+		if (Target.bBuildEditor && Target.Version.MajorVersion >= 5)
+		{
+			PrivateDependencyModuleNames.AddRange(new string[]
+			{
+				"TraceAnalysis"
+			});
+		}
 	}
 }
@@ -0,0 +1,203 @@
+// Copyright 2022, Aquanox.
+
+#include "SubsystemBrowserInventoryCommandlet.h"
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserUtils.h"
+#include "SubsystemBrowserTrace.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+
+USubsystemBrowserInventoryCommandlet::USubsystemBrowserInventoryCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Dump subsystem inventory of registered subsystem browser categories as JSON Lines");
+	HelpUsage = TEXT("-run=SubsystemBrowserInventory [-Map=/Game/Maps/MapName] [-Output=Path/To/Inventory.jsonl]");
+	HelpParamNames.Add(TEXT("Map"));
+	HelpParamDescriptions.Add(TEXT("Optional map package to load. Empty world is used if not specified."));
+	HelpParamNames.Add(TEXT("Output"));
+	HelpParamDescriptions.Add(TEXT("Output file path. Defaults to Saved/SubsystemBrowser/Inventory.jsonl"));
+}
+
+int32 USubsystemBrowserInventoryCommandlet::Main(const FString& Params)
+{
+	SB_TRACE_SCOPE(USubsystemBrowserInventoryCommandlet::Main);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FString MapName;
+	FParse::Value(*Params, TEXT("Map="), MapName);
+
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SubsystemBrowser"), TEXT("Inventory.jsonl"));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	TUniquePtr<FArchive> OutputAr(IFileManager::Get().CreateFileWriter(*OutputPath));
+	if (!OutputAr.IsValid())
+	{
+		UE_LOG(LogSubsystemBrowser, Error, TEXT("Failed to open %s for writing"), *OutputPath);
+		return 1;
+	}
+
+	bool bCreatedWorld = false;
+	UWorld* World = CreateInventoryWorld(MapName, bCreatedWorld);
+	if (!World)
+	{
+		UE_LOG(LogSubsystemBrowser, Error, TEXT("Failed to load map %s"), *MapName);
+		return 1;
+	}
+
+	BuildPluginIndex();
+
+	TArray<UObject*> Objects;
+	for (const SubsystemCategoryPtr& Category : FSubsystemBrowserModule::Get().GetCategories())
+	{
+		Objects.Reset();
+		Category->Select(World, Objects);
+		for (UObject* Object : Objects)
+		{
+			WriteRecord(*OutputAr, *Category, Object, false);
+		}
+
+		Objects.Reset();
+		Category->SelectSettings(Objects);
+		for (UObject* Object : Objects)
+		{
+			WriteRecord(*OutputAr, *Category, Object, true);
+		}
+	}
+
+	const bool bSuccess = OutputAr->Close() && !OutputAr->IsError();
+
+	if (bCreatedWorld)
+	{
+		World->DestroyWorld(false);
+	}
+	else
+	{
+		World->CleanupWorld();
+		World->RemoveFromRoot();
+	}
+
+	UE_LOG(LogSubsystemBrowser, Display, TEXT("Wrote %d subsystem records to %s in %.2f seconds"),
+		NumRecords, *OutputPath, FPlatformTime::Seconds() - StartTime);
+
+	return bSuccess ? 0 : 1;
+}
+
+void USubsystemBrowserInventoryCommandlet::BuildPluginIndex()
+{
+	PluginsByModule.Reset();
+
+	for (TSharedRef<IPlugin>& Plugin : IPluginManager::Get().GetDiscoveredPlugins())
+	{
+		for (const FModuleDescriptor& ModuleDescriptor : Plugin->GetDescriptor().Modules)
+		{
+			PluginsByModule.Add(ModuleDescriptor.Name, Plugin);
+		}
+	}
+}
+
+UWorld* USubsystemBrowserInventoryCommandlet::CreateInventoryWorld(const FString& InMapName, bool& bOutCreated) const
+{
+	if (InMapName.IsEmpty())
+	{
+		bOutCreated = true;
+		return UWorld::CreateWorld(EWorldType::Editor, false, TEXT("SubsystemBrowserInventory"));
+	}
+
+	bOutCreated = false;
+
+	FString PackageName = InMapName;
+	if (!FPackageName::IsValidLongPackageName(PackageName) && !FPackageName::SearchForPackageOnDisk(InMapName, &PackageName))
+	{
+		return nullptr;
+	}
+
+	UPackage* Package = LoadPackage(nullptr, *PackageName, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	World->AddToRoot();
+	World->WorldType = EWorldType::Editor;
+
+	if (!World->bIsWorldInitialized)
+	{
+		UWorld::InitializationValues IVS;
+		IVS.InitializeScenes(false)
+			.AllowAudioPlayback(false)
+			.RequiresHitProxies(false)
+			.CreatePhysicsScene(false)
+			.CreateNavigation(false)
+			.CreateAISystem(false)
+			.ShouldSimulatePhysics(false)
+			.SetTransactional(false);
+		World->InitWorld(IVS);
+	}
+
+	return World;
+}
+
+void USubsystemBrowserInventoryCommandlet::WriteRecord(FArchive& Ar, const FSubsystemCategory& InCategory, UObject* InObject, bool bSettings)
+{
+	if (!IsValid(InObject))
+	{
+		return;
+	}
+
+	UClass* const Class = InObject->GetClass();
+
+	FString ModuleName;
+	bool bIsGameModule = false;
+	if (!FSubsystemBrowserUtils::GetModuleDetailsForClass(Class, ModuleName, bIsGameModule))
+	{
+		ModuleName = FPackageName::GetShortName(Class->GetOuterUPackage());
+	}
+
+	const TSharedRef<IPlugin>* Plugin = PluginsByModule.Find(FPackageName::GetShortFName(Class->GetOuterUPackage()->GetFName()));
+
+	const FSubsystemBrowserUtils::FClassFieldStats FieldStats = FSubsystemBrowserUtils::GetClassFieldStats(Class);
+
+	RecordBuffer.Reset();
+
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RecordBuffer);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("category"), InCategory.GetID().ToString());
+	Writer->WriteValue(TEXT("source"), FString(bSettings ? TEXT("settings") : TEXT("instance")));
+	Writer->WriteValue(TEXT("class"), Class->GetPathName());
+	Writer->WriteValue(TEXT("module"), ModuleName);
+	Writer->WriteValue(TEXT("gameModule"), bIsGameModule);
+	Writer->WriteValue(TEXT("plugin"), Plugin ? (*Plugin)->GetName() : FString());
+	Writer->WriteValue(TEXT("config"), Class->HasAnyClassFlags(CLASS_Config) ? Class->ClassConfigName.ToString() : FString());
+	Writer->WriteValue(TEXT("defaultConfig"), Class->HasAnyClassFlags(CLASS_DefaultConfig));
+	Writer->WriteObjectStart(TEXT("stats"));
+	Writer->WriteValue(TEXT("properties"), FieldStats.NumProperties);
+	Writer->WriteValue(TEXT("editable"), FieldStats.NumEditable);
+	Writer->WriteValue(TEXT("config"), FieldStats.NumConfig);
+	Writer->WriteValue(TEXT("configEditable"), FieldStats.NumConfigWithEdit);
+	Writer->WriteValue(TEXT("callable"), FieldStats.NumCallable);
+	Writer->WriteObjectEnd();
+	Writer->WriteValue(TEXT("owner"), bSettings ? FString() : FSubsystemBrowserUtils::GetSubsystemOwnerName(InObject));
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	RecordBuffer += TEXT("\n");
+
+	FTCHARToUTF8 Converted(*RecordBuffer, RecordBuffer.Len());
+	Ar.Serialize((void*)Converted.Get(), Converted.Length());
+
+	++NumRecords;
+}
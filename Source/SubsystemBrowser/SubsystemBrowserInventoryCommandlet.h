@@ -0,0 +1,44 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreFwd.h"
+#include "Commandlets/Commandlet.h"
+#include "SubsystemBrowserInventoryCommandlet.generated.h"
+
+class IPlugin;
+struct FSubsystemCategory;
+
+/**
+ * Headless dump of subsystem inventory.
+ *
+ * Enumerates every registered subsystem category for a world and its settings objects,
+ * writing one JSON record per subsystem (JSON Lines format).
+ *
+ * Usage: -run=SubsystemBrowserInventory [-Map=/Game/Maps/MapName] [-Output=Path/To/Inventory.jsonl]
+ */
+UCLASS()
+class USubsystemBrowserInventoryCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+public:
+	USubsystemBrowserInventoryCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/* Build module name to plugin lookup once instead of scanning all plugins for every class */
+	void BuildPluginIndex();
+
+	/* Load requested map or create an empty world */
+	UWorld* CreateInventoryWorld(const FString& InMapName, bool& bOutCreated) const;
+
+	/* Serialize one record and append it to output */
+	void WriteRecord(FArchive& Ar, const FSubsystemCategory& InCategory, UObject* InObject, bool bSettings);
+
+	TMap<FName, TSharedRef<IPlugin>> PluginsByModule;
+
+	/* Reused between records to keep memory flat */
+	FString RecordBuffer;
+	int32 NumRecords = 0;
+};
@@ -9,6 +9,10 @@
 #include "Model/Column/SubsystemBrowserColumn_Config.h"
 #include "Model/Column/SubsystemBrowserColumn_Module.h"
 #include "Model/Column/SubsystemBrowserColumn_Plugin.h"
+#include "Model/Column/SubsystemBrowserColumn_Watch.h"
+#include "Model/Column/SubsystemBrowserColumn_Memory.h"
+#include "Model/Column/SubsystemBrowserColumn_TickCost.h"
+#include "Model/Column/SubsystemBrowserColumn_Profile.h"
 #include "Model/Category/SubsystemBrowserCategory_Editor.h"
 #include "Model/Category/SubsystemBrowserCategory_Engine.h"
 #include "Model/Category/SubsystemBrowserCategory_GameInstance.h"
@@ -23,6 +27,7 @@
 #include "ToolMenus.h"
 #include "WorkspaceMenuStructure.h"
 #include "WorkspaceMenuStructureModule.h"
+#include "Misc/CoreDelegates.h"
 
 IMPLEMENT_MODULE(FSubsystemBrowserModule, SubsystemBrowser);
 
@@ -40,6 +45,11 @@ FSubsystemBrowserModule::FOnCustomizeDetails FSubsystemBrowserModule::OnCustomiz
 
 void FSubsystemBrowserModule::StartupModule()
 {
+	// Register default columns and categories on startup
+	// Done for commandlets too, so inventory commandlet can enumerate them
+	RegisterDefaultDynamicColumns();
+	RegisterDefaultCategories();
+
 	if (GIsEditor && !IsRunningCommandlet())
 	{
 		FSubsystemBrowserStyle::Register();
@@ -76,18 +86,26 @@ void FSubsystemBrowserModule::StartupModule()
 					.SetIcon(FStyleHelper::GetSlateIcon(FStyleHelper::PanelIconName));
 		}
 
-		// Register default columns and categories on startup
-		RegisterDefaultDynamicColumns();
-		RegisterDefaultCategories();
-
 		// Register plugin settings
 		RegisterSettings();
 
+		// Register details view property actions
+		PropertyWatcher.Register();
+		DataBreakpoints.Register();
+
 		//
 		UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FSubsystemBrowserModule::RegisterMenus));
+
+		// Write pending settings before engine shuts down
+		FCoreDelegates::OnPreExit.AddRaw(this, &FSubsystemBrowserModule::HandlePreExit);
 	}
 }
 
+void FSubsystemBrowserModule::HandlePreExit()
+{
+	USubsystemBrowserSettings::Get()->FlushConfig();
+}
+
 void FSubsystemBrowserModule::RegisterSettings()
 {
 	ISettingsModule& SettingsModule = FModuleManager::GetModuleChecked<ISettingsModule>(TEXT("Settings"));
@@ -117,8 +135,21 @@ void FSubsystemBrowserModule::ShutdownModule()
 {
 	if (GIsEditor && !IsRunningCommandlet())
 	{
+		FCoreDelegates::OnPreExit.RemoveAll(this);
+
+		if (UObjectInitialized())
+		{
+			USubsystemBrowserSettings::Get()->FlushConfig();
+		}
+
 		PluginSettingsSection.Reset();
 
+		PropertyWatcher.Unregister();
+		DataBreakpoints.Unregister();
+		MemoryStats.Reset();
+		TickStats.Reset();
+		ProfileImport.Reset();
+
 		if (!bNomadModeActive)
 		{
 			if (FLevelEditorModule* LevelEditorModule = FModuleManager::GetModulePtr<FLevelEditorModule>(TEXT("LevelEditor")))
@@ -210,6 +241,12 @@ void FSubsystemBrowserModule::RegisterDefaultDynamicColumns()
 	RegisterDynamicColumn(MakeShared<FSubsystemDynamicColumn_Module>());
 	RegisterDynamicColumn(MakeShared<FSubsystemDynamicColumn_Config>());
 	RegisterDynamicColumn(MakeShared<FSubsystemDynamicColumn_Plugin>());
+	RegisterDynamicColumn(MakeShared<FSubsystemDynamicColumn_Watch>());
+	RegisterDynamicColumn(MakeShared<FSubsystemDynamicColumn_Memory>(true));
+	RegisterDynamicColumn(MakeShared<FSubsystemDynamicColumn_Memory>(false));
+	RegisterDynamicColumn(MakeShared<FSubsystemDynamicColumn_TickCost>());
+	RegisterDynamicColumn(MakeShared<FSubsystemDynamicColumn_Profile>(false));
+	RegisterDynamicColumn(MakeShared<FSubsystemDynamicColumn_Profile>(true));
 }
 
 void FSubsystemBrowserModule::RegisterCategory(TSharedRef<FSubsystemCategory> InCategory)
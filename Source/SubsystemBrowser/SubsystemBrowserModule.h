@@ -7,6 +7,11 @@
 #include "Modules/ModuleManager.h"
 #include "Model/SubsystemBrowserCategory.h" // [no-fwd]
 #include "Model/SubsystemBrowserColumn.h" // [no-fwd]
+#include "Model/SubsystemBrowserPropertyWatch.h" // [no-fwd]
+#include "Model/SubsystemBrowserDataBreakpoints.h" // [no-fwd]
+#include "Model/SubsystemBrowserMemoryStats.h" // [no-fwd]
+#include "Model/SubsystemBrowserTickStats.h" // [no-fwd]
+#include "Model/SubsystemBrowserProfileImport.h" // [no-fwd]
 
 class FSpawnTabArgs;
 class UToolMenu;
@@ -75,6 +80,31 @@ public:
 	 */
 	static void AddPermanentColumns(TArray<SubsystemColumnPtr>& Columns);
 
+	/**
+	 * Get registry of properties watched from details view
+	 */
+	FSubsystemPropertyWatcher& GetPropertyWatcher() { return PropertyWatcher; }
+
+	/**
+	 * Get registry of data breakpoints set from details view
+	 */
+	FSubsystemDataBreakpoints& GetDataBreakpoints() { return DataBreakpoints; }
+
+	/**
+	 * Get cache of subsystem memory footprints measured in background
+	 */
+	FSubsystemMemoryStats& GetMemoryStats() { return MemoryStats; }
+
+	/**
+	 * Get sampler of subsystem tick times
+	 */
+	FSubsystemTickStats& GetTickStats() { return TickStats; }
+
+	/**
+	 * Get timings imported from profiling capture
+	 */
+	FSubsystemProfileImport& GetProfileImport() { return ProfileImport; }
+
 	/**
 	 * Open subsystems tab
 	 */
@@ -115,6 +145,7 @@ public:
 protected:
 	void RegisterSettings();
 	void RegisterMenus();
+	void HandlePreExit();
 
 	/** Handles creating the subsystem browser tab. */
 	TSharedRef<SDockTab> HandleSpawnBrowserTab(const FSpawnTabArgs& Args);
@@ -126,6 +157,16 @@ private:
 	TArray<SubsystemCategoryPtr> Categories;
 	// Instances of dynamic subsystem columns
 	TArray<SubsystemColumnPtr> DynamicColumns;
+	// Watched properties of live objects
+	FSubsystemPropertyWatcher PropertyWatcher;
+	// Data breakpoints on properties of live objects
+	FSubsystemDataBreakpoints DataBreakpoints;
+	// Memory footprints of live objects
+	FSubsystemMemoryStats MemoryStats;
+	// Tick times of tickable objects
+	FSubsystemTickStats TickStats;
+	// Timings of subsystems imported from profiling capture
+	FSubsystemProfileImport ProfileImport;
 
 
 	// Saved instance of Settings section
@@ -18,6 +18,9 @@
 
 USubsystemBrowserSettings::FSettingChangedEvent USubsystemBrowserSettings::SettingChangedEvent;
 
+// Delay between first unsaved change and config write
+static const float GSubsystemBrowserConfigFlushDelay = 2.f;
+
 const FName FSubsystemBrowserConfigMeta::MD_ConfigAffectsView(TEXT("ConfigAffectsView"));
 const FName FSubsystemBrowserConfigMeta::MD_ConfigAffectsColumns(TEXT("ConfigAffectsColumns"));
 const FName FSubsystemBrowserConfigMeta::MD_ConfigAffectsDetails(TEXT("ConfigAffectsDetails"));
@@ -41,19 +44,23 @@ void LoadDataFromConfig(const TList& InConfigList, TMap& OutMap)
 }
 
 template <typename TList, typename TMap>
-void StoreDataToConfig(const TMap& InMap, TList& OutConfigList)
+bool StoreDataToConfig(const TMap& InMap, TList& OutConfigList)
 {
+	bool bChanged = false;
 	for (const auto& Option : InMap)
 	{
 		if (auto Existing = OutConfigList.FindByKey(Option.Key))
 		{
+			bChanged |= Existing->bValue != Option.Value;
 			Existing->bValue = Option.Value;
 		}
 		else
 		{
 			OutConfigList.Emplace(Option.Key, Option.Value);
+			bChanged = true;
 		}
 	}
+	return bChanged;
 }
 
 template <typename TMap>
@@ -98,9 +105,19 @@ void USubsystemBrowserSettings::SetDefaults()
 	bShowSubobjects = true;
 	bShowDetailedTooltips = false;
 	bShowAllWorlds = false;
+	bShowPerformanceStats = false;
+	bLiveChangeDetection = false;
+	ChangeDetectionInterval = 30;
+	ChangeDetectionBudget = 0.5f;
+	ChangeHighlightDuration = 2.f;
+	WatchSampleInterval = 0.f;
+	TimelineFrameInterval = 10;
+	TimelineKeyframeInterval = 30;
+	TimelineFrameBudget = 0.1f;
 	IgnoredSubsystems.Empty();
 
 	bForceHiddenPropertyVisibility = false;
+	bEditInAllPlayWorlds = false;
 	bUseCustomPropertyFilterInBrowser = true;
 	bShowAnyProperties = false;
 	bEditAnyProperties = false;
@@ -115,6 +132,7 @@ void USubsystemBrowserSettings::SetDefaults()
 	StaleStateColor = FLinearColor(0.75, 0.75, 0.75, 1.0);
 	bEnableSelectedColor = false;
 	SelectedStateColor = FLinearColor(0.828, 0.364, 0.003, 1.0);
+	ChangedStateColor = FLinearColor(0.9, 0.8, 0.1, 1.0);
 	bEnableColoringGameModule = false;
 	GameModuleColor = FLinearColor(0.4, 0.4, 1.0, 1.0);
 	bEnableColoringEngineModule = false;
@@ -135,6 +153,10 @@ bool USubsystemBrowserSettings::OnSettingsReset()
 
 	TGuardValue<bool> Guard(bReloadingConfig, true);
 
+	// Unsaved changes are discarded by reset
+	bConfigDirty = false;
+	FTickerHelper::RemoveTicker(ConfigFlushHandle);
+
 	bool bResettable = GetClass()->HasAnyClassFlags(CLASS_Config)
 		&& !GetClass()->HasAnyClassFlags(CLASS_DefaultConfig | CLASS_GlobalUserConfig | CLASS_ProjectUserConfig);
 	if (ensureAlways(bResettable))
@@ -216,9 +238,11 @@ void USubsystemBrowserSettings::LoadTreeExpansionStates(TMap<FName, bool>& State
 
 void USubsystemBrowserSettings::SetTreeExpansionStates(TMap<FName, bool> const& States)
 {
-	StoreDataToConfig(States, TreeExpansionState);
-	// Do not notify
-	//NotifyPropertyChange(GET_MEMBER_NAME_CHECKED(ThisClass, TreeExpansionState));
+	// Do not notify, only persist actual changes
+	if (StoreDataToConfig(States, TreeExpansionState))
+	{
+		MarkConfigDirty();
+	}
 }
 
 ESubsystemBrowserSplitterOrientation USubsystemBrowserSettings::GetSeparatorOrientation() const
@@ -278,6 +302,12 @@ void USubsystemBrowserSettings::SetShowSubobjects(bool bNewValue)
 	NotifyPropertyChange(GET_MEMBER_NAME_CHECKED(ThisClass, bShowSubobjects));
 }
 
+void USubsystemBrowserSettings::SetEditInAllPlayWorlds(bool bNewValue)
+{
+	bEditInAllPlayWorlds = bNewValue;
+	NotifyPropertyChange(GET_MEMBER_NAME_CHECKED(ThisClass, bEditInAllPlayWorlds));
+}
+
 void USubsystemBrowserSettings::SetForceHiddenPropertyVisibility(bool bNewValue)
 {
 	bForceHiddenPropertyVisibility = bNewValue;
@@ -380,12 +410,47 @@ void USubsystemBrowserSettings::NotifyPropertyChange(FName PropertyName)
 	
 	if (!bReloadingConfig)
 	{
-		SaveConfig();
+		MarkConfigDirty();
 	}
 
 	SettingChangedEvent.Broadcast(PropertyName);
 }
 
+void USubsystemBrowserSettings::MarkConfigDirty()
+{
+	bConfigDirty = true;
+
+	if (!ConfigFlushHandle.IsValid())
+	{
+		ConfigFlushHandle = FTickerHelper::AddTicker(
+			FTickerDelegate::CreateUObject(this, &USubsystemBrowserSettings::HandleConfigFlushTimer),
+			GSubsystemBrowserConfigFlushDelay);
+	}
+}
+
+bool USubsystemBrowserSettings::HandleConfigFlushTimer(float DeltaTime)
+{
+	ConfigFlushHandle.Reset();
+
+	FlushConfig();
+
+	// single-shot
+	return false;
+}
+
+void USubsystemBrowserSettings::FlushConfig()
+{
+	FTickerHelper::RemoveTicker(ConfigFlushHandle);
+
+	if (bConfigDirty)
+	{
+		UE_LOG(LogSubsystemBrowser, Verbose, TEXT("Saving browser settings"));
+
+		bConfigDirty = false;
+		SaveConfig();
+	}
+}
+
 void USubsystemBrowserSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
@@ -4,6 +4,7 @@
 
 #include "CoreFwd.h"
 #include "Styling/SlateColor.h"
+#include "SubsystemBrowserTicker.h"
 #include "SubsystemBrowserSettings.generated.h"
 
 USTRUCT()
@@ -130,6 +131,11 @@ public:
 	// UFUNCTION(CallInEditor, DisplayName="Reset to Defaults", Category="Actions")
 	void SetDefaults();
 
+	// Write pending config changes to disk immediately
+	void FlushConfig();
+	// Are there config changes waiting to be written
+	bool IsConfigDirty() const { return bConfigDirty; }
+
 	DECLARE_MULTICAST_DELEGATE_OneParam(FSettingChangedEvent, FName /* InPropertyName */);
 	static FSettingChangedEvent& OnSettingChanged() { return SettingChangedEvent; }
 
@@ -158,6 +164,7 @@ public:
 
 	FSlateColor GetSelectedColor() const;
 	FSlateColor GetStaleColor() const;
+	FSlateColor GetChangedColor() const { return ChangedStateColor; }
 	FSlateColor GetModuleColor(bool bGameModule);
 
 	bool ShouldShowSubobjbects() const { return bShowSubobjects; }
@@ -166,6 +173,10 @@ public:
 
 	bool ShouldUseCustomPropertyFilteringInBrowser() const { return bUseCustomPropertyFilterInBrowser; }
 	
+	bool ShouldEditInAllPlayWorlds() const { return bEditInAllPlayWorlds; }
+	void SetEditInAllPlayWorlds(bool bNewValue);
+	void ToggleEditInAllPlayWorlds() { SetEditInAllPlayWorlds(!bEditInAllPlayWorlds); }
+
 	bool ShouldForceHiddenPropertyVisibility() const { return bForceHiddenPropertyVisibility; }
 	void SetForceHiddenPropertyVisibility(bool bNewValue);
 	void ToggleForceHiddenPropertyVisibility() { SetForceHiddenPropertyVisibility(!bForceHiddenPropertyVisibility); }
@@ -198,6 +209,7 @@ public:
 	bool ShouldUseSubsystemSettings() const { return bUseSubsystemSettings; }
 	bool ShouldUseCustomSettingsWidget() const { return bUseCustomSettingsWidget; }
 	bool ShouldUseCustomPropertyFilterInSettings() const { return bUseCustomPropertyFilterInSettings; }
+	int32 GetMaxCachedSettingsWidgets() const { return FMath::Max(1, MaxCachedSettingsWidgets); }
 
 	bool ShouldUseNomadMode() const { return bUseNomadMode; }
 
@@ -205,6 +217,18 @@ public:
 
 	bool ShouldDisplayAllWorlds() const { return bShowAllWorlds; }
 	bool ShouldDisplayConfigExportActions() const { return bConfigExportActions; }
+	bool ShouldShowPerformanceStats() const { return bShowPerformanceStats; }
+
+	bool ShouldDetectChanges() const { return bLiveChangeDetection; }
+	uint32 GetChangeDetectionInterval() const { return (uint32)FMath::Max(1, ChangeDetectionInterval); }
+	double GetChangeDetectionBudget() const { return FMath::Max(0.01f, ChangeDetectionBudget) / 1000.0; }
+	double GetChangeHighlightDuration() const { return ChangeHighlightDuration; }
+
+	float GetWatchSampleInterval() const { return WatchSampleInterval; }
+
+	uint32 GetTimelineFrameInterval() const { return (uint32)FMath::Max(1, TimelineFrameInterval); }
+	int32 GetTimelineKeyframeInterval() const { return FMath::Max(1, TimelineKeyframeInterval); }
+	double GetTimelineFrameBudget() const { return FMath::Max(0.01f, TimelineFrameBudget) / 1000.0; }
 
 	bool HasIgnoredSubsystems() const { return IgnoredSubsystems.Num() > 0; }
 	bool IsSubsystemIgnored(FString InClass) const;
@@ -252,6 +276,44 @@ protected:
 	UPROPERTY(Config, EditAnywhere, Category="Browser Panel")
 	bool bConfigExportActions = false;
 
+	// Display timings of last populate, filter, sort and details refresh next to subsystem counter
+	// Full history is available in tooltip and via SubsystemBrowser.Stats console command
+	UPROPERTY(Config, EditAnywhere, Category="Browser Panel")
+	bool bShowPerformanceStats = false;
+
+	// Periodically hash reflected state of displayed subsystems and highlight rows which state changed
+	UPROPERTY(Config, EditAnywhere, Category="Browser Panel")
+	bool bLiveChangeDetection = false;
+
+	// Number of frames between two change detection passes
+	UPROPERTY(Config, EditAnywhere, Category="Browser Panel", meta=(ClampMin=1, EditCondition="bLiveChangeDetection"))
+	int32 ChangeDetectionInterval = 30;
+
+	// Maximum time in milliseconds change detection may spend per frame
+	// Pass over all subsystems is spread over multiple frames when budget is exceeded
+	UPROPERTY(Config, EditAnywhere, Category="Browser Panel", meta=(ClampMin=0.01, Units="ms", EditCondition="bLiveChangeDetection"))
+	float ChangeDetectionBudget = 0.5f;
+
+	// Time in seconds changed row stays highlighted
+	UPROPERTY(Config, EditAnywhere, Category="Browser Panel", meta=(ClampMin=0, Units="s", EditCondition="bLiveChangeDetection"))
+	float ChangeHighlightDuration = 2.f;
+
+	// Time in seconds between two samples of watched properties. Zero samples every frame
+	UPROPERTY(Config, EditAnywhere, Category="Browser Panel", meta=(ClampMin=0, Units="s"))
+	float WatchSampleInterval = 0.f;
+
+	// Number of frames between two timeline recording passes
+	UPROPERTY(Config, EditAnywhere, Category="Browser Panel", meta=(ClampMin=1))
+	int32 TimelineFrameInterval = 10;
+
+	// Every Nth timeline recording pass stores full state, other passes store only changed values
+	UPROPERTY(Config, EditAnywhere, Category="Browser Panel", meta=(ClampMin=1))
+	int32 TimelineKeyframeInterval = 30;
+
+	// Maximum time in milliseconds timeline recording may spend per frame
+	UPROPERTY(Config, EditAnywhere, Category="Browser Panel", meta=(ClampMin=0.01, Units="ms"))
+	float TimelineFrameBudget = 0.1f;
+
 	// Matching objects will be automatically filtered out
 	UPROPERTY(Config, EditAnywhere, Category="Browser Panel", meta=(ConfigAffectsView, TitleProperty="FilterString"))
 	TArray<FSubsystemIgnoreListEntry> IgnoredSubsystems;
@@ -261,6 +323,11 @@ protected:
 	UPROPERTY(Config, EditAnywhere, Category="Browser Panel Details", meta=(ConfigAffectsDetails))
 	bool bForceHiddenPropertyVisibility = false;
 
+	// Display selected subsystem of every play world in details at once, so one edit applies to all of them.
+	// Applies to world, game instance and local player subsystems selected in a play world
+	UPROPERTY(Config, EditAnywhere, Category="Browser Panel Details", meta=(ConfigAffectsDetails))
+	bool bEditInAllPlayWorlds = false;
+
 	// Enables custom property filtering.
 	// Hides Delegates and explicitly hidden properties from Details. Additional options below.
 	UPROPERTY(Config, EditAnywhere, Category="Browser Panel Details", meta=(ConfigAffectsDetails))
@@ -303,6 +370,10 @@ protected:
 	UPROPERTY(Config, EditAnywhere, Category="Browser Panel Appearance", meta=(EditCondition="bEnableSelectedColor"))
 	FLinearColor SelectedStateColor = FLinearColor(0.828, 0.364, 0.003, 1.0);
 
+	// Color of rows recently changed according to live change detection
+	UPROPERTY(Config, EditAnywhere, Category="Browser Panel Appearance")
+	FLinearColor ChangedStateColor = FLinearColor(0.9, 0.8, 0.1, 1.0);
+
 	UPROPERTY(Config, EditAnywhere, Category="Browser Panel Appearance", meta=(InlineEditConditionToggle))
 	bool bEnableColoringGameModule = false;
 	UPROPERTY(Config, EditAnywhere, Category="Browser Panel Appearance", meta=(EditCondition="bEnableColoringGameModule"))
@@ -348,6 +419,10 @@ protected:
 	// Enables use of custom property filter in Settings panel.
 	UPROPERTY(Config, EditAnywhere, Category="Settings Panel", meta=(ConfigRestartRequired=true))
 	bool bUseCustomPropertyFilterInSettings = true;
+	// Maximum number of custom settings widgets kept alive in Settings panel.
+	// Widgets are constructed when section is first viewed, least recently viewed ones are released above this limit.
+	UPROPERTY(Config, EditAnywhere, Category="Settings Panel", meta=(ClampMin=1, EditCondition="bUseCustomSettingsWidget"))
+	int32 MaxCachedSettingsWidgets = 8;
 
 private:
 	bool bReloadingConfig = false;
@@ -355,6 +430,15 @@ private:
 	// Notify system that a property was externally changed
 	void NotifyPropertyChange(FName PropertyName);
 
+	// Schedule deferred config save. Multiple changes within delay are written with single SaveConfig
+	void MarkConfigDirty();
+	bool HandleConfigFlushTimer(float DeltaTime);
+
+	// Has unsaved config changes
+	bool bConfigDirty = false;
+	// Pending deferred save
+	FTickerHelper::FHandle ConfigFlushHandle;
+
 	// Holds an event delegate that is executed when a setting has changed.
 	static FSettingChangedEvent SettingChangedEvent;
 
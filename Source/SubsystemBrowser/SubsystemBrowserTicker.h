@@ -0,0 +1,37 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreFwd.h"
+#include "Containers/Ticker.h"
+#include "Misc/EngineVersionComparison.h"
+
+/**
+ * Internal class for core ticker compatibility between older and newer engines.
+ */
+struct FTickerHelper
+{
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+	using TickerType = FTicker;
+	using FHandle = FDelegateHandle;
+#else
+	using TickerType = FTSTicker;
+	using FHandle = FTSTicker::FDelegateHandle;
+#endif
+
+	/** Register delegate within core ticker */
+	static FHandle AddTicker(const FTickerDelegate& InDelegate, float InDelay = 0.f)
+	{
+		return TickerType::GetCoreTicker().AddTicker(InDelegate, InDelay);
+	}
+
+	/** Unregister delegate from core ticker and reset handle */
+	static void RemoveTicker(FHandle& InHandle)
+	{
+		if (InHandle.IsValid())
+		{
+			TickerType::GetCoreTicker().RemoveTicker(InHandle);
+			InHandle.Reset();
+		}
+	}
+};
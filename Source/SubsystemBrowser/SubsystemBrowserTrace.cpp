@@ -0,0 +1,125 @@
+// Copyright 2022, Aquanox.
+
+#include "SubsystemBrowserTrace.h"
+
+#if !UE_VERSION_OLDER_THAN(4, 26, 0)
+#include "ProfilingDebugging/CountersTrace.h"
+#define SB_WITH_TRACE_COUNTERS 1
+#else
+#define SB_WITH_TRACE_COUNTERS 0
+#endif
+
+#if SB_WITH_TRACE_CHANNEL
+UE_TRACE_CHANNEL_DEFINE(SubsystemBrowserChannel);
+#endif
+
+DEFINE_STAT(STAT_SubsystemBrowser_ModelPopulate);
+DEFINE_STAT(STAT_SubsystemBrowser_ModelFilter);
+DEFINE_STAT(STAT_SubsystemBrowser_ModelSort);
+DEFINE_STAT(STAT_SubsystemBrowser_DescriptorConstruct);
+DEFINE_STAT(STAT_SubsystemBrowser_ClassLookup);
+DEFINE_STAT(STAT_SubsystemBrowser_DetailsRefresh);
+DEFINE_STAT(STAT_SubsystemBrowser_SettingsDiscovery);
+
+DEFINE_STAT(STAT_SubsystemBrowser_NumCategories);
+DEFINE_STAT(STAT_SubsystemBrowser_NumSubsystems);
+DEFINE_STAT(STAT_SubsystemBrowser_DetailsPoolHits);
+DEFINE_STAT(STAT_SubsystemBrowser_DetailsPoolMisses);
+DEFINE_STAT(STAT_SubsystemBrowser_SettingsWidgetHits);
+DEFINE_STAT(STAT_SubsystemBrowser_SettingsWidgetMisses);
+
+DEFINE_STAT(STAT_SubsystemBrowser_DescriptorMemory);
+
+#if SB_WITH_TRACE_COUNTERS
+TRACE_DECLARE_INT_COUNTER(SubsystemBrowser_NumCategories, TEXT("SubsystemBrowser/Categories"));
+TRACE_DECLARE_INT_COUNTER(SubsystemBrowser_NumSubsystems, TEXT("SubsystemBrowser/Subsystems"));
+TRACE_DECLARE_MEMORY_COUNTER(SubsystemBrowser_DescriptorMemory, TEXT("SubsystemBrowser/DescriptorMemory"));
+TRACE_DECLARE_FLOAT_COUNTER(SubsystemBrowser_DetailsPoolHitRatio, TEXT("SubsystemBrowser/DetailsPoolHitRatio"));
+TRACE_DECLARE_FLOAT_COUNTER(SubsystemBrowser_SettingsWidgetHitRatio, TEXT("SubsystemBrowser/SettingsWidgetHitRatio"));
+#endif
+
+namespace SubsystemBrowserTrace
+{
+	/* Lookups into each cache, accessed on game thread only */
+	static uint32 CacheHits[(int32)FSubsystemBrowserTrace::ECache::Num] = { 0 };
+	static uint32 CacheLookups[(int32)FSubsystemBrowserTrace::ECache::Num] = { 0 };
+
+	static int32 NumCategories = 0;
+	static int32 NumSubsystems = 0;
+	static int64 DescriptorBytes = 0;
+}
+
+void FSubsystemBrowserTrace::RecordCacheAccess(ECache InCache, bool bHit)
+{
+	using namespace SubsystemBrowserTrace;
+
+	check(InCache < ECache::Num);
+
+	++CacheLookups[(int32)InCache];
+	CacheHits[(int32)InCache] += bHit ? 1 : 0;
+
+	switch (InCache)
+	{
+	case ECache::DetailsPool:
+		INC_DWORD_STAT(bHit ? STAT_SubsystemBrowser_DetailsPoolHits : STAT_SubsystemBrowser_DetailsPoolMisses);
+#if SB_WITH_TRACE_COUNTERS
+		TRACE_COUNTER_SET(SubsystemBrowser_DetailsPoolHitRatio, GetCacheHitRatio(InCache));
+#endif
+		break;
+	case ECache::SettingsWidget:
+		INC_DWORD_STAT(bHit ? STAT_SubsystemBrowser_SettingsWidgetHits : STAT_SubsystemBrowser_SettingsWidgetMisses);
+#if SB_WITH_TRACE_COUNTERS
+		TRACE_COUNTER_SET(SubsystemBrowser_SettingsWidgetHitRatio, GetCacheHitRatio(InCache));
+#endif
+		break;
+	default:
+		break;
+	}
+}
+
+void FSubsystemBrowserTrace::ModifyModelItems(int32 InCategoriesDelta, int32 InSubsystemsDelta, int64 InDescriptorBytesDelta)
+{
+	using namespace SubsystemBrowserTrace;
+
+	NumCategories += InCategoriesDelta;
+	NumSubsystems += InSubsystemsDelta;
+	DescriptorBytes += InDescriptorBytesDelta;
+
+	SET_DWORD_STAT(STAT_SubsystemBrowser_NumCategories, NumCategories);
+	SET_DWORD_STAT(STAT_SubsystemBrowser_NumSubsystems, NumSubsystems);
+	SET_MEMORY_STAT(STAT_SubsystemBrowser_DescriptorMemory, DescriptorBytes);
+
+#if SB_WITH_TRACE_COUNTERS
+	TRACE_COUNTER_SET(SubsystemBrowser_NumCategories, NumCategories);
+	TRACE_COUNTER_SET(SubsystemBrowser_NumSubsystems, NumSubsystems);
+	TRACE_COUNTER_SET(SubsystemBrowser_DescriptorMemory, DescriptorBytes);
+#endif
+}
+
+float FSubsystemBrowserTrace::GetCacheHitRatio(ECache InCache)
+{
+	using namespace SubsystemBrowserTrace;
+
+	check(InCache < ECache::Num);
+
+	const uint32 Lookups = CacheLookups[(int32)InCache];
+	return Lookups ? (float)CacheHits[(int32)InCache] / Lookups : 0.f;
+}
+
+void FSubsystemBrowserTrace::ResetCacheStats()
+{
+	using namespace SubsystemBrowserTrace;
+
+	FMemory::Memzero(CacheHits);
+	FMemory::Memzero(CacheLookups);
+
+	SET_DWORD_STAT(STAT_SubsystemBrowser_DetailsPoolHits, 0);
+	SET_DWORD_STAT(STAT_SubsystemBrowser_DetailsPoolMisses, 0);
+	SET_DWORD_STAT(STAT_SubsystemBrowser_SettingsWidgetHits, 0);
+	SET_DWORD_STAT(STAT_SubsystemBrowser_SettingsWidgetMisses, 0);
+
+#if SB_WITH_TRACE_COUNTERS
+	TRACE_COUNTER_SET(SubsystemBrowser_DetailsPoolHitRatio, 0.f);
+	TRACE_COUNTER_SET(SubsystemBrowser_SettingsWidgetHitRatio, 0.f);
+#endif
+}
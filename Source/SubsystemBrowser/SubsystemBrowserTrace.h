@@ -0,0 +1,83 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreFwd.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Misc/EngineVersionComparison.h"
+
+#if !UE_VERSION_OLDER_THAN(4, 26, 0)
+#include "Trace/Trace.h"
+#define SB_WITH_TRACE_CHANNEL 1
+#else
+#define SB_WITH_TRACE_CHANNEL 0
+#endif
+
+#if SB_WITH_TRACE_CHANNEL
+/** Trace channel for subsystem browser events, enable with -trace=cpu,SubsystemBrowser */
+UE_TRACE_CHANNEL_EXTERN(SubsystemBrowserChannel, SUBSYSTEMBROWSER_API);
+
+/** Named cpu scope reported within SubsystemBrowser trace channel */
+#define SB_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, SubsystemBrowserChannel)
+#else
+#define SB_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE(Name)
+#endif
+
+/**
+ * Scope reported to specified cycle stat, or named cpu scope within SubsystemBrowser trace channel without stats.
+ *
+ * Cycle counters already emit cpu trace events when stats are traced, so only one of them is used
+ * to avoid every scope appearing twice in Insights.
+ */
+#if STATS
+#define SB_TRACE_STAT_SCOPE(Name, Stat) SCOPE_CYCLE_COUNTER(Stat)
+#else
+#define SB_TRACE_STAT_SCOPE(Name, Stat) SB_TRACE_SCOPE(Name)
+#endif
+
+DECLARE_STATS_GROUP(TEXT("SubsystemBrowser"), STATGROUP_SubsystemBrowser, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Model Populate"), STAT_SubsystemBrowser_ModelPopulate, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Model Filter"), STAT_SubsystemBrowser_ModelFilter, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Model Sort"), STAT_SubsystemBrowser_ModelSort, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Descriptor Construct"), STAT_SubsystemBrowser_DescriptorConstruct, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Class Lookups"), STAT_SubsystemBrowser_ClassLookup, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Details Refresh"), STAT_SubsystemBrowser_DetailsRefresh, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Settings Discovery"), STAT_SubsystemBrowser_SettingsDiscovery, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Categories"), STAT_SubsystemBrowser_NumCategories, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Subsystems"), STAT_SubsystemBrowser_NumSubsystems, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Details Pool Hits"), STAT_SubsystemBrowser_DetailsPoolHits, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Details Pool Misses"), STAT_SubsystemBrowser_DetailsPoolMisses, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Settings Widget Hits"), STAT_SubsystemBrowser_SettingsWidgetHits, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Settings Widget Misses"), STAT_SubsystemBrowser_SettingsWidgetMisses, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Descriptor Memory"), STAT_SubsystemBrowser_DescriptorMemory, STATGROUP_SubsystemBrowser, SUBSYSTEMBROWSER_API);
+
+/**
+ * Counters shared between stats system and Insights counters track.
+ *
+ * Values are global for all browser panels and settings editor.
+ */
+struct SUBSYSTEMBROWSER_API FSubsystemBrowserTrace
+{
+	enum class ECache : uint8
+	{
+		DetailsPool,
+		SettingsWidget,
+		Num
+	};
+
+	/** Record a lookup into one of browser caches */
+	static void RecordCacheAccess(ECache InCache, bool bHit);
+
+	/** Adjust number of live model items and memory used by their descriptors */
+	static void ModifyModelItems(int32 InCategoriesDelta, int32 InSubsystemsDelta, int64 InDescriptorBytesDelta);
+
+	/** Get ratio of hits to total lookups for cache, or 0 if there were none */
+	static float GetCacheHitRatio(ECache InCache);
+
+	/** Forget recorded lookups of all caches */
+	static void ResetCacheStats();
+};
@@ -5,6 +5,8 @@
 #include "SubsystemBrowserFlags.h"
 #include "SubsystemBrowserModule.h"
 #include "SubsystemBrowserSettings.h"
+#include "SubsystemBrowserTrace.h"
+#include "Engine/GameInstance.h"
 #include "Engine/LocalPlayer.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
@@ -12,19 +14,33 @@
 #include "HAL/FileManager.h"
 #include "HAL/PlatformApplicationMisc.h"
 #include "Interfaces/IPluginManager.h"
+#include "ISourceControlModule.h"
+#include "Misc/ConfigCacheIni.h"
 #include "Misc/EngineVersionComparison.h"
 #include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/StringBuilder.h"
 #include "Model/SubsystemBrowserDescriptor.h"
+#include "PropertyHandle.h"
+#include "SourceControlHelpers.h"
+#include "Subsystems/GameInstanceSubsystem.h"
 #include "Subsystems/LocalPlayerSubsystem.h"
+#include "Subsystems/Subsystem.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "UObject/Package.h"
 #include "UObject/TextProperty.h"
 #include "UObject/UObjectHash.h"
 
+#if !UE_VERSION_OLDER_THAN(5, 1, 0)
+#include "Misc/ConfigContext.h"
+#endif
+
 #define LOCTEXT_NAMESPACE "SubsystemBrowser"
 
 TOptional<FString> FSubsystemBrowserUtils::GetSmartMetaValue(UObject* InObject, const FName& InName, bool bHierarchical, bool bWarn)
 {
+	SB_TRACE_SCOPE(FSubsystemBrowserUtils::GetSmartMetaValue);
+
 	TOptional<FString> UserSource;
 
 	if (bHierarchical)
@@ -77,6 +93,8 @@ TOptional<FString> FSubsystemBrowserUtils::GetSmartMetaValue(UObject* InObject,
 
 FString FSubsystemBrowserUtils::GetSubsystemOwnerName(UObject* Instance)
 {
+	SB_TRACE_SCOPE(FSubsystemBrowserUtils::GetSubsystemOwnerName);
+
 	// First try searching for user function or
 	TOptional<FString> UserSource = GetSmartMetaValue(Instance, FSubsystemBrowserUserMeta::MD_SBOwnerName, true);
 	if (UserSource.IsSet())
@@ -115,6 +133,8 @@ FString FSubsystemBrowserUtils::GetModulePathForClass(UClass* InClass)
 
 bool FSubsystemBrowserUtils::GetModuleDetailsForClass(UClass* InClass, FString& OutName, bool& OutGameFlag)
 {
+	SB_TRACE_STAT_SCOPE(FSubsystemBrowserUtils::GetModuleDetailsForClass, STAT_SubsystemBrowser_ClassLookup);
+
 	OutName = TEXT("Unknown");
 	OutGameFlag = false;
 
@@ -158,6 +178,8 @@ bool FSubsystemBrowserUtils::GetModuleDetailsForClass(UClass* InClass, FString&
 
 bool FSubsystemBrowserUtils::GetPluginDetailsForClass(UClass* InClass, FString& OutName, FString& OutFriendlyName)
 {
+	SB_TRACE_STAT_SCOPE(FSubsystemBrowserUtils::GetPluginDetailsForClass, STAT_SubsystemBrowser_ClassLookup);
+
 	if (InClass)
 	{
 		if (UPackage* ClassPackage = InClass->GetOuterUPackage())
@@ -187,6 +209,8 @@ bool FSubsystemBrowserUtils::GetPluginDetailsForClass(UClass* InClass, FString&
 
 void FSubsystemBrowserUtils::CollectSourceFiles(UClass* InClass, TArray<FString>& OutSourceFiles)
 {
+	SB_TRACE_STAT_SCOPE(FSubsystemBrowserUtils::CollectSourceFiles, STAT_SubsystemBrowser_ClassLookup);
+
 	OutSourceFiles.Empty();
 
 	if (InClass)
@@ -209,6 +233,8 @@ void FSubsystemBrowserUtils::CollectSourceFiles(UClass* InClass, TArray<FString>
 
 FSubsystemBrowserUtils::FClassFieldStats FSubsystemBrowserUtils::GetClassFieldStats(UClass* InClass)
 {
+	SB_TRACE_STAT_SCOPE(FSubsystemBrowserUtils::GetClassFieldStats, STAT_SubsystemBrowser_ClassLookup);
+
 	FClassFieldStats Stats;
 
 	for (TFieldIterator<FProperty> It(InClass); It; ++It)
@@ -287,84 +313,192 @@ FString FSubsystemBrowserUtils::GenerateConfigExport(const FSubsystemTreeSubsyst
 
 FString FSubsystemBrowserUtils::GenerateConfigExport(const UObject* Subsystem, bool bModifiedOnly)
 {
-	UClass* const Class = Subsystem->GetClass();
-
-	FString ConfigBlock;
-	ConfigBlock.Reserve(256);
-	ConfigBlock += FString::Printf(TEXT("; Should be in %s%s"), *Class->GetConfigName(), LINE_TERMINATOR);
-	ConfigBlock += FString::Printf(TEXT("; or defaults %s%s"), *Class->GetDefaultConfigFilename(), LINE_TERMINATOR);
-	ConfigBlock += FString::Printf(TEXT("[%s.%s]%s"), *Class->GetOuterUPackage()->GetName(), *Class->GetName(), LINE_TERMINATOR);
+	TStringBuilder<1024> ConfigBlock;
+	AppendConfigExport(ConfigBlock, Subsystem, bModifiedOnly, true);
+	return FString(ConfigBlock.ToString());
+}
 
-	UObject* const SubsystemDefaults  = Class ? Class->GetDefaultObject() : nullptr;
+namespace SubsystemConfigExport
+{
+	static bool IsConfigProperty(const FProperty* InProperty)
+	{
+		return InProperty->HasAnyPropertyFlags(CPF_Config)
+			&& !InProperty->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient | CPF_Deprecated | CPF_SkipSerialization);
+	}
 
-	if (Subsystem && SubsystemDefaults && Class)
+	/* class which defaults config values of object are compared with */
+	static UClass* GetDefaultsClass(const UObject* InObject)
 	{
-		TArray<FProperty*> ModifiedProperties;
+		// settings objects are their own class defaults, compare them to defaults of parent class instead.
+		// properties introduced by class itself are then compared to zero values
+		UClass* const Class = InObject->GetClass();
+		return InObject->HasAnyFlags(RF_ClassDefaultObject) ? Class->GetSuperClass() : Class;
+	}
 
-		for (TFieldIterator<FProperty> It(Class); It; ++It)
+	static bool IsModified(const UObject* InObject, UClass* InDefaultsClass, UObject* InDefaults, const FProperty* InProperty)
+	{
+		for (int32 Idx = 0; Idx < InProperty->ArrayDim; Idx++)
 		{
-			FProperty* Property = *It;
-			if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient | CPF_Deprecated | CPF_SkipSerialization))
-				continue;
-
-			if( Property->HasAnyPropertyFlags(CPF_Config) )
+			const uint8* DataPtr = InProperty->ContainerPtrToValuePtr<uint8>(InObject, Idx);
+			const uint8* DefaultValue = InProperty->ContainerPtrToValuePtrForDefaults<uint8>(InDefaultsClass, InDefaults, Idx);
+			if (!InProperty->Identical(DataPtr, DefaultValue, PPF_DeepCompareInstances))
 			{
-				for( int32 Idx=0; Idx<Property->ArrayDim; Idx++ )
-				{
-					const uint8* DataPtr = Property->ContainerPtrToValuePtr<uint8>(Subsystem, Idx);
-					const uint8* DefaultValue = Property->ContainerPtrToValuePtrForDefaults<uint8>(Class, SubsystemDefaults, Idx);
-					if (bModifiedOnly == false || !Property->Identical(DataPtr, DefaultValue, PPF_DeepCompareInstances))
-					{
-						ModifiedProperties.Add(Property);
-						break;
-					}
-				}
+				return true;
 			}
 		}
+		return false;
+	}
+}
+
+bool FSubsystemBrowserUtils::AppendConfigExport(FStringBuilderBase& ConfigBlock, const UObject* Subsystem, bool bModifiedOnly, bool bWithLocationHint)
+{
+	SB_TRACE_SCOPE(FSubsystemBrowserUtils::AppendConfigExport);
+
+	UClass* const Class = Subsystem ? Subsystem->GetClass() : nullptr;
+	if (!Class)
+	{
+		return false;
+	}
+
+	UClass* const DefaultsClass = SubsystemConfigExport::GetDefaultsClass(Subsystem);
+	UObject* const SubsystemDefaults = DefaultsClass ? DefaultsClass->GetDefaultObject() : nullptr;
+	if (!SubsystemDefaults)
+	{
+		return false;
+	}
+
+	bool bHasHeader = false;
+	auto AppendHeader = [&]()
+	{
+		if (bWithLocationHint)
+		{
+			ConfigBlock << TEXT("; Should be in ") << *Class->GetConfigName() << LINE_TERMINATOR;
+			ConfigBlock << TEXT("; or defaults ") << *Class->GetDefaultConfigFilename() << LINE_TERMINATOR;
+		}
+		ConfigBlock << TEXT("[") << *Class->GetOuterUPackage()->GetName() << TEXT(".") << *Class->GetName() << TEXT("]") << LINE_TERMINATOR;
+		bHasHeader = true;
+	};
 
-		for (FProperty* Property : ModifiedProperties)
+	// reused between properties to avoid reallocations
+	FString ExportValue;
+
+	for (TFieldIterator<FProperty> It(Class); It; ++It)
+	{
+		FProperty* Property = *It;
+		if (!SubsystemConfigExport::IsConfigProperty(Property))
+			continue;
+		if (bModifiedOnly && !SubsystemConfigExport::IsModified(Subsystem, DefaultsClass, SubsystemDefaults, Property))
+			continue;
+
+		if (!bHasHeader)
 		{
-			const TCHAR* Prefix = TEXT("");
+			AppendHeader();
+		}
 
-			if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
-			{
-				ConfigBlock += FString::Printf(TEXT("!%s=ClearArray"), *Property->GetName());
-				ConfigBlock += LINE_TERMINATOR;
-				Prefix = TEXT("+");
+		const TCHAR* Prefix = TEXT("");
 
-				FScriptArrayHelper ArrayHelper(ArrayProperty, Subsystem);
-				if (!ArrayHelper.Num())
-				{
-					continue;
-				}
-			}
+		if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			ConfigBlock << TEXT("!") << *Property->GetName() << TEXT("=ClearArray") << LINE_TERMINATOR;
+			Prefix = TEXT("+");
 
-			for( int32 Idx=0; Idx< Property->ArrayDim; Idx++ )
+			FScriptArrayHelper ArrayHelper(ArrayProperty, Property->ContainerPtrToValuePtr<void>(Subsystem));
+			if (!ArrayHelper.Num())
 			{
-				const uint8* DataPtr = Property->ContainerPtrToValuePtr<uint8>(Subsystem, Idx);
-				const uint8* DefaultValue = Property->ContainerPtrToValuePtrForDefaults<uint8>(Class, SubsystemDefaults, Idx);
+				continue;
+			}
+		}
+
+		for (int32 Idx = 0; Idx < Property->ArrayDim; Idx++)
+		{
+			const uint8* DataPtr = Property->ContainerPtrToValuePtr<uint8>(Subsystem, Idx);
+			const uint8* DefaultValue = Property->ContainerPtrToValuePtrForDefaults<uint8>(DefaultsClass, SubsystemDefaults, Idx);
 
-				FString ExportValue;
+			ExportValue.Reset();
 #if UE_VERSION_OLDER_THAN(5,1,0)
-				Property->ExportTextItem(ExportValue, DataPtr, DefaultValue, nullptr, 0);
+			Property->ExportTextItem(ExportValue, DataPtr, DefaultValue, nullptr, 0);
 #else
-				Property->ExportTextItem_Direct(ExportValue, DataPtr, DefaultValue, nullptr, 0);
+			Property->ExportTextItem_Direct(ExportValue, DataPtr, DefaultValue, nullptr, 0);
 #endif
 
-				if (ExportValue.IsEmpty())
-				{
-					ConfigBlock += FString::Printf(TEXT("%s="), *Property->GetName());
-				}
-				else
-				{
-					ConfigBlock += FString::Printf(TEXT("%s%s=%s"), Prefix, *Property->GetName(), *ExportValue);
-				}
-				ConfigBlock += LINE_TERMINATOR;
+			if (ExportValue.IsEmpty())
+			{
+				ConfigBlock << *Property->GetName() << TEXT("=");
+			}
+			else
+			{
+				ConfigBlock << Prefix << *Property->GetName() << TEXT("=") << *ExportValue;
 			}
+			ConfigBlock << LINE_TERMINATOR;
+		}
+	}
+
+	return bHasHeader;
+}
+
+int32 FSubsystemBrowserUtils::ExportConfigToFile(const TArray<UObject*>& Objects, const FString& FilePath, bool bModifiedOnly)
+{
+	SB_TRACE_SCOPE(FSubsystemBrowserUtils::ExportConfigToFile);
+
+	TArray<const UObject*> ConfigObjects;
+	ConfigObjects.Reserve(Objects.Num());
+	for (const UObject* Object : Objects)
+	{
+		if (IsValid(Object) && Object->GetClass()->HasAnyClassFlags(CLASS_Config) && !Object->GetClass()->ClassConfigName.IsNone())
+		{
+			ConfigObjects.Add(Object);
 		}
 	}
 
-	return ConfigBlock;
+	// group sections by config they belong to
+	ConfigObjects.StableSort([](const UObject& A, const UObject& B)
+	{
+		return A.GetClass()->ClassConfigName.Compare(B.GetClass()->ClassConfigName) < 0;
+	});
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(LogSubsystemBrowser, Error, TEXT("Failed to open %s for writing"), *FilePath);
+		return INDEX_NONE;
+	}
+
+	// each section is flushed to file as soon as it is generated so buffer never grows past a single section
+	TStringBuilder<4096> Section;
+	auto FlushSection = [&Section, &Writer]()
+	{
+		FTCHARToUTF8 Converted(Section.ToString(), Section.Len());
+		Writer->Serialize((void*)Converted.Get(), Converted.Length());
+		Section.Reset();
+	};
+
+	int32 NumSections = 0;
+	FName CurrentConfigName;
+	for (const UObject* Object : ConfigObjects)
+	{
+		UClass* const Class = Object->GetClass();
+		if (Class->ClassConfigName != CurrentConfigName)
+		{
+			Section << TEXT(";") << LINE_TERMINATOR;
+			Section << TEXT("; ") << *Class->ClassConfigName.ToString() << LINE_TERMINATOR;
+			Section << TEXT(";") << LINE_TERMINATOR;
+		}
+
+		// objects without properties to write leave no trace, including config name banner
+		if (!AppendConfigExport(Section, Object, bModifiedOnly, false))
+		{
+			Section.Reset();
+			continue;
+		}
+
+		CurrentConfigName = Class->ClassConfigName;
+		Section << LINE_TERMINATOR;
+		FlushSection();
+		NumSections++;
+	}
+
+	const bool bSuccess = Writer->Close() && !Writer->IsError();
+	return bSuccess ? NumSections : INDEX_NONE;
 }
 
 void FSubsystemBrowserUtils::ShowBrowserInfoMessage(FText InText, SNotificationItem::ECompletionState InType)
@@ -400,6 +534,238 @@ bool FSubsystemBrowserUtils::TryUpdateDefaultConfigFile(UObject* Instance)
 #endif
 }
 
+namespace SubsystemConfigMerge
+{
+	/* Check out file or make sure it is writable, done once per file */
+	static bool PrepareFileForWrite(const FString& InFilePath)
+	{
+		if (!FPaths::FileExists(InFilePath))
+		{
+			return true;
+		}
+
+		if (ISourceControlModule::Get().IsEnabled() && IFileManager::Get().IsReadOnly(*InFilePath))
+		{
+			USourceControlHelpers::CheckOutOrAddFile(InFilePath, true);
+		}
+
+		return !IFileManager::Get().IsReadOnly(*InFilePath);
+	}
+
+	/* Gather config properties of object that differ from its defaults */
+	static void GatherModifiedProperties(const UObject* InObject, TArray<const FProperty*>& OutProperties)
+	{
+		UClass* const DefaultsClass = SubsystemConfigExport::GetDefaultsClass(InObject);
+		UObject* const Defaults = DefaultsClass ? DefaultsClass->GetDefaultObject() : nullptr;
+		if (!Defaults)
+		{
+			return;
+		}
+
+		for (TFieldIterator<FProperty> It(InObject->GetClass()); It; ++It)
+		{
+			if (SubsystemConfigExport::IsConfigProperty(*It) && SubsystemConfigExport::IsModified(InObject, DefaultsClass, Defaults, *It))
+			{
+				OutProperties.Add(*It);
+			}
+		}
+	}
+
+	/* Section of object in config file, per object sections are named after object */
+	static FString GetSectionName(const UObject* InObject)
+	{
+		UClass* const Class = InObject->GetClass();
+		if (Class->HasAnyClassFlags(CLASS_PerObjectConfig))
+		{
+			return FString::Printf(TEXT("%s %s"), *InObject->GetName(), *Class->GetName());
+		}
+		return FString::Printf(TEXT("%s.%s"), *Class->GetOuterUPackage()->GetName(), *Class->GetName());
+	}
+
+	static void RemoveKey(FConfigFile& File, const FString& InSection, const FString& InKey)
+	{
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+		if (FConfigSection* Section = File.Find(InSection))
+		{
+			Section->Remove(*InKey);
+		}
+#else
+		File.RemoveKeyFromSection(*InSection, *InKey);
+#endif
+	}
+
+	static void AddKey(FConfigFile& File, const FString& InSection, const FString& InKey, const FString& InValue)
+	{
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+		File.FindOrAdd(InSection).Add(*InKey, InValue);
+#else
+		File.AddToSection(*InSection, *InKey, InValue);
+#endif
+	}
+
+	static FString ExportValue(const FProperty* InProperty, const void* InValue)
+	{
+		FString Value;
+#if UE_VERSION_OLDER_THAN(5,1,0)
+		InProperty->ExportTextItem(Value, InValue, nullptr, nullptr, 0);
+#else
+		InProperty->ExportTextItem_Direct(Value, InValue, nullptr, nullptr, 0);
+#endif
+		return Value;
+	}
+
+	/* Replace all entries of property in section with current values of object, using the same key syntax engine reads */
+	static void ApplyProperty(FConfigFile& File, const FString& InSection, const UObject* InObject, const FProperty* InProperty)
+	{
+		const FString Name = InProperty->GetName();
+
+		// drop every form the value could have been written in before
+		RemoveKey(File, InSection, Name);
+		RemoveKey(File, InSection, TEXT("+") + Name);
+		RemoveKey(File, InSection, TEXT("-") + Name);
+		RemoveKey(File, InSection, TEXT(".") + Name);
+		RemoveKey(File, InSection, TEXT("!") + Name);
+		for (int32 Idx = 0; Idx < InProperty->ArrayDim; Idx++)
+		{
+			RemoveKey(File, InSection, FString::Printf(TEXT("%s[%d]"), *Name, Idx));
+		}
+
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty))
+		{
+			AddKey(File, InSection, TEXT("!") + Name, TEXT("ClearArray"));
+
+			FScriptArrayHelper Helper(ArrayProperty, InProperty->ContainerPtrToValuePtr<void>(InObject));
+			for (int32 Idx = 0; Idx < Helper.Num(); Idx++)
+			{
+				AddKey(File, InSection, TEXT("+") + Name, ExportValue(ArrayProperty->Inner, Helper.GetRawPtr(Idx)));
+			}
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(InProperty))
+		{
+			AddKey(File, InSection, TEXT("!") + Name, TEXT("ClearArray"));
+
+			FScriptSetHelper Helper(SetProperty, InProperty->ContainerPtrToValuePtr<void>(InObject));
+			for (int32 Idx = 0; Idx < Helper.GetMaxIndex(); Idx++)
+			{
+				if (Helper.IsValidIndex(Idx))
+				{
+					AddKey(File, InSection, TEXT("+") + Name, ExportValue(SetProperty->ElementProp, Helper.GetElementPtr(Idx)));
+				}
+			}
+		}
+		else if (InProperty->ArrayDim > 1)
+		{
+			for (int32 Idx = 0; Idx < InProperty->ArrayDim; Idx++)
+			{
+				AddKey(File, InSection, FString::Printf(TEXT("%s[%d]"), *Name, Idx), ExportValue(InProperty, InProperty->ContainerPtrToValuePtr<void>(InObject, Idx)));
+			}
+		}
+		else
+		{
+			AddKey(File, InSection, Name, ExportValue(InProperty, InProperty->ContainerPtrToValuePtr<void>(InObject)));
+		}
+	}
+
+	/* Reload config branch from disk so config cache sees values that were written */
+	static void ReloadConfig(const FString& InBaseIniName)
+	{
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+		FString FinalIniName;
+		FConfigCacheIni::LoadGlobalIniFile(FinalIniName, *InBaseIniName, nullptr, true);
+#else
+		FConfigContext::ForceReloadIntoGConfig().Load(*InBaseIniName);
+#endif
+	}
+}
+
+FSubsystemBrowserUtils::FDefaultConfigUpdateResult FSubsystemBrowserUtils::UpdateDefaultConfigFiles(const TArray<UObject*>& Objects)
+{
+	SB_TRACE_SCOPE(FSubsystemBrowserUtils::UpdateDefaultConfigFiles);
+
+	FDefaultConfigUpdateResult Result;
+
+	TMap<FString, TArray<UObject*>> ObjectsByFile;
+	for (UObject* Object : Objects)
+	{
+		if (!IsValid(Object) || !Object->GetClass()->HasAnyClassFlags(CLASS_DefaultConfig))
+			continue;
+
+		ObjectsByFile.FindOrAdd(FPaths::ConvertRelativePathToFull(Object->GetDefaultConfigFilename())).AddUnique(Object);
+	}
+
+	TArray<const FProperty*> ModifiedProperties;
+	TSet<FString> ConfigsToReload;
+
+	for (const TPair<FString, TArray<UObject*>>& Entry : ObjectsByFile)
+	{
+		const FString& FilePath = Entry.Key;
+		const bool bFileExists = FPaths::FileExists(FilePath);
+
+		// file is read raw so array operators are kept as they are and written back once with all objects applied
+		FConfigFile File;
+		if (bFileExists)
+		{
+			File.Read(FilePath);
+		}
+
+		int32 NumModifiedObjects = 0;
+		for (UObject* Object : Entry.Value)
+		{
+			ModifiedProperties.Reset();
+			SubsystemConfigMerge::GatherModifiedProperties(Object, ModifiedProperties);
+			if (!ModifiedProperties.Num())
+				continue;
+
+			const FString SectionName = SubsystemConfigMerge::GetSectionName(Object);
+			for (const FProperty* Property : ModifiedProperties)
+			{
+				SubsystemConfigMerge::ApplyProperty(File, SectionName, Object, Property);
+			}
+			++NumModifiedObjects;
+		}
+
+		// objects without modified values leave file untouched
+		if (!NumModifiedObjects)
+			continue;
+
+		if (!SubsystemConfigMerge::PrepareFileForWrite(FilePath))
+		{
+			UE_LOG(LogSubsystemBrowser, Error, TEXT("Failed to check out %s"), *FilePath);
+			Result.FailedFiles.Add(FilePath);
+			continue;
+		}
+
+		File.Dirty = true;
+		if (!File.Write(FilePath))
+		{
+			UE_LOG(LogSubsystemBrowser, Error, TEXT("Failed to write %s"), *FilePath);
+			Result.FailedFiles.Add(FilePath);
+			continue;
+		}
+
+		// new files are only known to source control after they are written
+		if (!bFileExists && ISourceControlModule::Get().IsEnabled())
+		{
+			USourceControlHelpers::CheckOutOrAddFile(FilePath, true);
+		}
+
+		for (const UObject* Object : Entry.Value)
+		{
+			ConfigsToReload.Add(Object->GetClass()->ClassConfigName.ToString());
+		}
+
+		Result.NumObjects += NumModifiedObjects;
+		++Result.NumFiles;
+	}
+
+	for (const FString& ConfigName : ConfigsToReload)
+	{
+		SubsystemConfigMerge::ReloadConfig(ConfigName);
+	}
+
+	return Result;
+}
+
 FText FSubsystemBrowserUtils::GetWorldDescription(const UWorld* World)
 {
 	if(!World)
@@ -484,6 +850,8 @@ UClass* FSubsystemBrowserUtils::TryFindClassByName(const FString& ClassName)
 
 void FSubsystemBrowserUtils::DefaultSelectSubsystemSubobjects(UObject* InSubsystem, TArray<UObject*>& OutData)
 {
+	SB_TRACE_SCOPE(FSubsystemBrowserUtils::DefaultSelectSubsystemSubobjects);
+
 	OutData.Empty();
 	
 	if (!IsValid(InSubsystem) || !IsValid(InSubsystem->GetClass()))
@@ -615,6 +983,8 @@ bool FSubsystemBrowserUtils::TryParseColor(const FString& InColor, FLinearColor&
 
 void FSubsystemBrowserUtils::GatherQuickActions(UObject* Object, TArray<FQuickActionData>& OutFunctions)
 {
+	SB_TRACE_SCOPE(FSubsystemBrowserUtils::GatherQuickActions);
+
 	if (!IsValid(Object))
 		return;
 
@@ -684,4 +1054,105 @@ FText FSubsystemBrowserUtils::WorldTypeToText(EWorldType::Type WorldType)
 	}
 }
 
+bool FSubsystemBrowserUtils::IsSubsystemOrSubobject(const UObject* InObject)
+{
+	return InObject && (InObject->IsA<USubsystem>() || InObject->GetTypedOuter<USubsystem>() != nullptr);
+}
+
+void FSubsystemBrowserUtils::CollectInstancesInPlayWorlds(UObject* InObject, TArray<UObject*>& OutObjects)
+{
+	OutObjects.Reset();
+	if (!IsValid(InObject))
+	{
+		return;
+	}
+
+	OutObjects.Add(InObject);
+
+	// editor world state should never propagate into play worlds
+	UWorld* const SourceWorld = InObject->GetWorld();
+	if (!SourceWorld || SourceWorld->WorldType != EWorldType::PIE)
+	{
+		return;
+	}
+
+	UClass* const Class = InObject->GetClass();
+	const bool bWorldSubsystem = InObject->IsA<UWorldSubsystem>();
+	const bool bGameInstanceSubsystem = InObject->IsA<UGameInstanceSubsystem>();
+	const bool bLocalPlayerSubsystem = InObject->IsA<ULocalPlayerSubsystem>();
+	if (!bWorldSubsystem && !bGameInstanceSubsystem && !bLocalPlayerSubsystem)
+	{
+		return;
+	}
+
+	// local player subsystems are matched by player index within game instance
+	int32 PlayerIndex = INDEX_NONE;
+	if (bLocalPlayerSubsystem)
+	{
+		UGameInstance* const SourceGameInstance = SourceWorld->GetGameInstance();
+		PlayerIndex = SourceGameInstance ? SourceGameInstance->GetLocalPlayers().IndexOfByKey(Cast<ULocalPlayer>(InObject->GetOuter())) : INDEX_NONE;
+		if (PlayerIndex == INDEX_NONE)
+		{
+			return;
+		}
+	}
+
+	for (const FWorldContext& Context : GEngine->GetWorldContexts())
+	{
+		UWorld* const World = Context.World();
+		if (!World || World == SourceWorld || World->WorldType != EWorldType::PIE)
+			continue;
+
+		UObject* Instance = nullptr;
+		if (bWorldSubsystem)
+		{
+			Instance = World->GetSubsystemBase(Class);
+		}
+		else if (UGameInstance* const GameInstance = World->GetGameInstance())
+		{
+			if (bGameInstanceSubsystem)
+			{
+				Instance = GameInstance->GetSubsystemBase(Class);
+			}
+			else if (GameInstance->GetLocalPlayers().IsValidIndex(PlayerIndex))
+			{
+				Instance = GameInstance->GetLocalPlayers()[PlayerIndex]->GetSubsystemBase(Class);
+			}
+		}
+
+		if (IsValid(Instance))
+		{
+			OutObjects.AddUnique(Instance);
+		}
+	}
+}
+
+bool FSubsystemBrowserUtils::ResolveStableValueAddress(const TSharedPtr<IPropertyHandle>& InHandle, UObject*& OutObject, void*& OutValuePtr)
+{
+	if (!InHandle.IsValid() || !InHandle->IsValidHandle() || !InHandle->GetProperty())
+		return false;
+
+	for (TSharedPtr<IPropertyHandle> Parent = InHandle->GetParentHandle(); Parent.IsValid(); Parent = Parent->GetParentHandle())
+	{
+		const FProperty* ParentProperty = Parent->GetProperty();
+		if (ParentProperty && (ParentProperty->IsA<FArrayProperty>() || ParentProperty->IsA<FSetProperty>() || ParentProperty->IsA<FMapProperty>()))
+		{
+			return false;
+		}
+	}
+
+	TArray<UObject*> OuterObjects;
+	InHandle->GetOuterObjects(OuterObjects);
+	if (OuterObjects.Num() != 1 || !IsValid(OuterObjects[0]))
+		return false;
+
+	void* ValuePtr = nullptr;
+	if (InHandle->GetValueData(ValuePtr) != FPropertyAccess::Success || !ValuePtr)
+		return false;
+
+	OutObject = OuterObjects[0];
+	OutValuePtr = ValuePtr;
+	return true;
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -5,6 +5,7 @@
 #include "Engine/EngineTypes.h"
 #include "Misc/Optional.h"
 #include "Misc/OutputDevice.h"
+#include "Misc/StringBuilder.h"
 #include "Widgets/Notifications/SNotificationList.h"
 
 /**
@@ -97,11 +98,45 @@ struct SUBSYSTEMBROWSER_API FSubsystemBrowserUtils
 	 */
 	static FString GenerateConfigExport(const UObject* Item, bool bModifiedOnly);
 
+	/**
+	 * Append config section of object to string builder.
+	 * Section is omitted entirely when there are no properties to write.
+	 * Class default objects, like settings, are compared against defaults of their parent class.
+	 * @param bWithLocationHint add comment with expected config file names before section
+	 * @return true if section was written
+	 */
+	static bool AppendConfigExport(FStringBuilderBase& Builder, const UObject* Item, bool bModifiedOnly, bool bWithLocationHint);
+
+	/**
+	 * Write config sections of multiple objects into a single ini file, grouped by config name.
+	 * @return number of sections written or INDEX_NONE if file could not be written
+	 */
+	static int32 ExportConfigToFile(const TArray<UObject*>& Objects, const FString& FilePath, bool bModifiedOnly);
+
 	/**
 	 * Legacy. Wrapper over UObject::UpdateDefaultConfigFile
 	 */
 	static bool TryUpdateDefaultConfigFile(UObject* Object);
 
+	struct FDefaultConfigUpdateResult
+	{
+		// number of objects which sections were written to successfully written files
+		int32 NumObjects = 0;
+		// number of files that were written
+		int32 NumFiles = 0;
+		// files that could not be checked out or written
+		TArray<FString> FailedFiles;
+	};
+
+	/**
+	 * Write modified config values of multiple DefaultConfig objects into their default config files.
+	 *
+	 * Objects are grouped by destination file, sections of all objects are merged into the file and it is written once.
+	 * Only properties that differ from defaults are written, config cache is reloaded from written files afterwards.
+	 * Files of objects without modified properties are not touched.
+	 */
+	static FDefaultConfigUpdateResult UpdateDefaultConfigFiles(const TArray<UObject*>& Objects);
+
 	/**
 	 * Build a text description for a world
 	 */
@@ -155,4 +190,21 @@ struct SUBSYSTEMBROWSER_API FSubsystemBrowserUtils
 	static void InvokeQuickAction(const FQuickActionData& ActionData);
 
 	static FText WorldTypeToText(EWorldType::Type WorldType);
+
+	/**
+	 * Is object a subsystem or one of subsystem subobjects
+	 */
+	static bool IsSubsystemOrSubobject(const UObject* InObject);
+
+	/**
+	 * Resolve address of value behind details property handle that stays valid while owning object is alive.
+	 * Fails for multiple selected objects and for values within dynamic containers as their storage may move.
+	 */
+	static bool ResolveStableValueAddress(const TSharedPtr<class IPropertyHandle>& InHandle, UObject*& OutObject, void*& OutValuePtr);
+
+	/**
+	 * Collect instances of same subsystem class in every play world, source object is always first.
+	 * World, game instance and local player subsystems of play worlds are supported, others yield only source object.
+	 */
+	static void CollectInstancesInPlayWorlds(UObject* InObject, TArray<UObject*>& OutObjects);
 };
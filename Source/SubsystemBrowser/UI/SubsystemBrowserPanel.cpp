@@ -6,14 +6,17 @@
 #include "SubsystemBrowserModule.h"
 #include "SubsystemBrowserSettings.h"
 #include "SubsystemBrowserStyle.h"
+#include "SubsystemBrowserTrace.h"
 #include "SubsystemBrowserUtils.h"
 #include "Components/SlateWrapperTypes.h"
 #include "Widgets/Input/SSearchBox.h"
 #include "Widgets/Layout/SSeparator.h"
+#include "Widgets/Layout/SWidgetSwitcher.h"
 #include "Widgets/Images/SImage.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Views/STableRow.h"
 #include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SSlider.h"
 #include "SlateOptMacros.h"
 #include "ToolMenus.h"
 #include "Editor.h"
@@ -21,8 +24,18 @@
 #include "IDetailsView.h"
 #include "PropertyEditorModule.h"
 #include "UI/SubsystemDetailsCustomizations.h"
+#include "UI/SubsystemSnapshotDiffView.h"
+#include "UI/SubsystemTimelineFrameView.h"
+#include "UI/SubsystemWorldCompareView.h"
+#include "Model/SubsystemBrowserSnapshot.h"
+#include "Model/SubsystemBrowserTimeline.h"
+#include "DesktopPlatformModule.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/FileManager.h"
 #include "HAL/PlatformApplicationMisc.h"
-#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/MessageDialog.h"
+#include "Misc/Paths.h"
 
 #define LOCTEXT_NAMESPACE "SubsystemBrowser"
 
@@ -37,6 +50,19 @@ SSubsystemBrowserPanel::~SSubsystemBrowserPanel()
 
 	GEngine->OnWorldAdded().RemoveAll(this);
 	GEngine->OnWorldDestroyed().RemoveAll(this);
+
+	for (const SubsystemColumnPtr& Column : DisplayedColumns)
+	{
+		Column->OnDisplayStateChanged(false);
+	}
+	DisplayedColumns.Empty();
+
+	// Persist UI state changes when tab is closed
+	if (bNeedsExpansionSettingsSave)
+	{
+		USubsystemBrowserSettings::Get()->SetTreeExpansionStates(GetParentsExpansionState());
+	}
+	USubsystemBrowserSettings::Get()->FlushConfig();
 }
 
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
@@ -62,6 +88,9 @@ void SSubsystemBrowserPanel::Construct(const FArguments& InArgs)
 	SubsystemModel = MakeShared<FSubsystemModel>();
 	SubsystemModel->SetCurrentWorld(InArgs._InWorld);
 	SubsystemModel->OnDataChanged.AddSP(this, &SSubsystemBrowserPanel::OnSubsystemDataChanged);
+	SubsystemModel->OnHierarchyChanged.AddSP(this, &SSubsystemBrowserPanel::FullRefresh);
+	SubsystemModel->OnRetainedGraphUpdated.AddSP(this, &SSubsystemBrowserPanel::OnRetainedGraphUpdated);
+	FSubsystemBrowserModule::Get().GetProfileImport().OnCompleted.AddSP(this, &SSubsystemBrowserPanel::OnProfileImportCompleted);
 
 	// Generate search box
 	SearchBoxSubsystemFilter = MakeShared<SubsystemTextFilter>(
@@ -70,7 +99,7 @@ void SSubsystemBrowserPanel::Construct(const FArguments& InArgs)
 	SearchBoxSubsystemFilter->OnChanged().AddSP(this, &SSubsystemBrowserPanel::FullRefresh);
 
 	// Generate category selector
-	CategoryFilter = MakeShared<SubsystemCategoryFilter>();
+	CategoryFilter = MakeShared<SubsystemCategoryFilter>(SubsystemModel->GetSettingsRef());
 	CategoryFilter->OnChanged().AddSP(this, &SSubsystemBrowserPanel::FullRefresh);
 
 	// Assign filters to model
@@ -82,7 +111,8 @@ void SSubsystemBrowserPanel::Construct(const FArguments& InArgs)
 	HeaderRowWidget = SNew(SSubsystemsHeaderRow, SubsystemModel, SharedThis(this));
 
 	// Build the details viewer
-	DetailsView = CreateDetails();
+	DetailsViewKey = GetDetailsViewKey();
+	DetailsView = AcquireDetails(DetailsViewKey);
 	check(DetailsView.IsValid());
 
 	// Build the actual subsystem browser view panel
@@ -245,6 +275,18 @@ void SSubsystemBrowserPanel::Construct(const FArguments& InArgs)
 							.ColorAndOpacity( this, &SSubsystemBrowserPanel::GetFilterStatusTextColor )
 						]
 
+						// Performance stats
+						+SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(0, 0, 8, 0)
+						[
+							SNew( STextBlock )
+							.Text( this, &SSubsystemBrowserPanel::GetPerfStatusText )
+							.ToolTipText( this, &SSubsystemBrowserPanel::GetPerfStatusTooltipText )
+							.Visibility( this, &SSubsystemBrowserPanel::GetPerfStatusVisibility )
+						]
+
 						// View mode combo button
 						+SHorizontalBox::Slot()
 						.AutoWidth()
@@ -276,6 +318,61 @@ void SSubsystemBrowserPanel::Construct(const FArguments& InArgs)
 						]
 					]
 
+					// Timeline scrubber
+					+SVerticalBox::Slot()
+					.Padding(0, 0, 0, 2)
+					.AutoHeight()
+					[
+						SNew(SHorizontalBox)
+						.Visibility(this, &SSubsystemBrowserPanel::GetTimelineVisibility)
+
+						+SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(8, 0, 4, 0)
+						[
+							SNew(STextBlock)
+							.Text(this, &SSubsystemBrowserPanel::GetTimelineFrameText)
+						]
+
+						+SHorizontalBox::Slot()
+						.FillWidth(1.f)
+						.VAlign(VAlign_Center)
+						[
+							SNew(SSlider)
+							.Value(this, &SSubsystemBrowserPanel::GetTimelineSliderValue)
+							.OnValueChanged(this, &SSubsystemBrowserPanel::OnTimelineSliderChanged)
+						]
+
+						+SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(4, 0, 0, 0)
+						[
+							SNew(SButton)
+							.ButtonStyle(FStyleHelper::GetWidgetStylePtr<FButtonStyle>("SimpleButton"))
+							.OnClicked(this, &SSubsystemBrowserPanel::OnTimelineLiveClicked)
+							.ToolTipText(LOCTEXT("TimelineLive_Tooltip", "Display live state of selected subsystem"))
+							[
+								SNew(STextBlock).Text(LOCTEXT("TimelineLive", "Live"))
+							]
+						]
+
+						+SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(0, 0, 8, 0)
+						[
+							SNew(SButton)
+							.ButtonStyle(FStyleHelper::GetWidgetStylePtr<FButtonStyle>("SimpleButton"))
+							.OnClicked(this, &SSubsystemBrowserPanel::OnTimelineCloseClicked)
+							.ToolTipText(LOCTEXT("TimelineClose_Tooltip", "Close timeline"))
+							[
+								SNew(STextBlock).Text(LOCTEXT("TimelineClose", "Close"))
+							]
+						]
+					]
+
 					// Separator
 					+SVerticalBox::Slot()
 					.AutoHeight()
@@ -287,11 +384,21 @@ void SSubsystemBrowserPanel::Construct(const FArguments& InArgs)
 				]
 				+ SSplitter::Slot()
 				[
-					SAssignNew( DetailsViewBox, SVerticalBox )
-					+SVerticalBox::Slot()
-					.Padding(0, 4, 0, 2)
+					SNew(SWidgetSwitcher)
+					.WidgetIndex(this, &SSubsystemBrowserPanel::GetDetailsWidgetIndex)
+					+ SWidgetSwitcher::Slot()
+					[
+						SAssignNew( DetailsViewBox, SVerticalBox )
+						+SVerticalBox::Slot()
+						.Padding(0, 4, 0, 2)
+						[
+							DetailsView.ToSharedRef()
+						]
+					]
+					// recorded state is displayed as text, live details are kept intact while scrubbing
+					+ SWidgetSwitcher::Slot()
 					[
-						DetailsView.ToSharedRef()
+						SAssignNew( TimelineFrameView, SSubsystemTimelineFrameView )
 					]
 				]
 			]
@@ -303,7 +410,7 @@ END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 void SSubsystemBrowserPanel::Tick(const FGeometry& AllotedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(SSubsystemBrowserPanel::Tick);
+	SB_TRACE_SCOPE(SSubsystemBrowserPanel::Tick);
 
 	SCompoundWidget::Tick(AllotedGeometry, InCurrentTime, InDeltaTime);
 
@@ -317,7 +424,7 @@ void SSubsystemBrowserPanel::Tick(const FGeometry& AllotedGeometry, const double
 
 	if (bSortDirty)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(SSubsystemBrowserPanel::RequestTreeRefresh);
+		SB_TRACE_SCOPE(SSubsystemBrowserPanel::RequestTreeRefresh);
 
 		// SortItems(RootTreeItems);
 		for (const auto& Pair : TreeItemMap)
@@ -330,9 +437,15 @@ void SSubsystemBrowserPanel::Tick(const FGeometry& AllotedGeometry, const double
 		bSortDirty = false;
 	}
 
+	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
+	if (Settings->ShouldDetectChanges())
+	{
+		SubsystemModel->TickChangeDetection(Settings->GetChangeDetectionInterval(), Settings->GetChangeDetectionBudget());
+	}
+
 	if (bNeedsColumnRefresh)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(SSubsystemBrowserPanel::RefreshColumns);
+		SB_TRACE_SCOPE(SSubsystemBrowserPanel::RefreshColumns);
 
 		bNeedsColumnRefresh = false;
 		HeaderRowWidget->RefreshColumns();
@@ -340,13 +453,30 @@ void SSubsystemBrowserPanel::Tick(const FGeometry& AllotedGeometry, const double
 
 	if (bNeedRefreshDetails || PendingSelectionObject.IsSet())
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(SSubsystemBrowserPanel::RefreshDetails);
+		SB_TRACE_STAT_SCOPE(SSubsystemBrowserPanel::RefreshDetails, STAT_SubsystemBrowser_DetailsRefresh);
+		FSubsystemPerfStats::FScope PerfScope(SubsystemModel->GetPerfStats(), ESubsystemPerfMetric::DetailsRefresh);
 
 		if (DetailsView.IsValid())
 		{
 			if (PendingSelectionObject.IsSet())
 			{
-				DetailsView->SetObject(PendingSelectionObject.GetValue().Get(), true);
+				UObject* const SelectedObject = PendingSelectionObject.GetValue().Get();
+
+				TArray<UObject*> SelectedObjects;
+				if (Settings->ShouldEditInAllPlayWorlds())
+				{
+					FSubsystemBrowserUtils::CollectInstancesInPlayWorlds(SelectedObject, SelectedObjects);
+				}
+
+				if (SelectedObjects.Num() > 1)
+				{
+					// property editor applies each change to all objects within single transaction
+					DetailsView->SetObjects(SelectedObjects, true);
+				}
+				else
+				{
+					DetailsView->SetObject(SelectedObject, true);
+				}
 			}
 			else
 			{
@@ -367,7 +497,7 @@ void SSubsystemBrowserPanel::Tick(const FGeometry& AllotedGeometry, const double
 
 void SSubsystemBrowserPanel::Populate()
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(SSubsystemBrowserPanel::Populate);
+	SB_TRACE_SCOPE(SSubsystemBrowserPanel::Populate);
 
 	TGuardValue<bool> ReentrantGuard(bIsReentrant, true);
 
@@ -377,6 +507,8 @@ void SSubsystemBrowserPanel::Populate()
 
 	if (bFullRefresh)
 	{
+		FSubsystemPerfStats::FScope PerfScope(SubsystemModel->GetPerfStats(), ESubsystemPerfMetric::Filter);
+
 		FilteredSubsystemsCount = 0;
 		EmptyTreeItems();
 		ResetSelectedObject();
@@ -405,10 +537,25 @@ void SSubsystemBrowserPanel::Populate()
 				{
 					SubsystemModel->GetSubsystemSubobjects(SubsystemItem, SubsystemItem->Children);
 				}
+
+				SubsystemModel->GetSubsystemRetainedGraph(SubsystemItem, SubsystemItem->Children);
 			}
 		}
 
+		PerfScope.SetNumItems(FilteredSubsystemsCount);
 		bFullRefresh = false;
+
+		// sample only what is displayed
+		TArray<SubsystemTreeItemPtr> SampledItems;
+		SampledItems.Reserve(TreeItemMap.Num());
+		for (const auto& Pair : TreeItemMap)
+		{
+			if (Pair.Value->GetType() != ISubsystemTreeItem::EItemType::Category)
+			{
+				SampledItems.Add(Pair.Value);
+			}
+		}
+		SubsystemModel->GetChangeSampler().SetItems(SampledItems);
 	}
 
 	SetParentsExpansionState(ExpansionStateInfo);
@@ -495,6 +642,39 @@ FText SSubsystemBrowserPanel::GetFilterStatusText() const
 	}
 }
 
+FText SSubsystemBrowserPanel::GetPerfStatusText() const
+{
+	const FSubsystemPerfStats& Stats = SubsystemModel->GetPerfStats();
+
+	FNumberFormattingOptions Options;
+	Options.MinimumFractionalDigits = 1;
+	Options.MaximumFractionalDigits = 1;
+
+	auto GetLastMs = [&Stats, &Options](ESubsystemPerfMetric Metric)
+	{
+		FSubsystemPerfStats::FSample Sample;
+		return Stats.GetLastSample(Metric, Sample) ? FText::AsNumber(Sample.Seconds * 1000.0, &Options) : INVTEXT("-");
+	};
+
+	FFormatNamedArguments Args;
+	Args.Add(TEXT("Populate"), GetLastMs(ESubsystemPerfMetric::Populate));
+	Args.Add(TEXT("Filter"), GetLastMs(ESubsystemPerfMetric::Filter));
+	Args.Add(TEXT("Sort"), GetLastMs(ESubsystemPerfMetric::Sort));
+	Args.Add(TEXT("Details"), GetLastMs(ESubsystemPerfMetric::DetailsRefresh));
+	Args.Add(TEXT("CacheHits"), FText::AsPercent(FSubsystemBrowserTrace::GetCacheHitRatio(FSubsystemBrowserTrace::ECache::DetailsPool)));
+	return FText::Format(LOCTEXT("PerfStatusFmt", "Populate {Populate} ms | Filter {Filter} ms | Sort {Sort} ms | Details {Details} ms ({CacheHits} pooled)"), Args);
+}
+
+FText SSubsystemBrowserPanel::GetPerfStatusTooltipText() const
+{
+	return FText::FromString(SubsystemModel->GetPerfStats().ToString());
+}
+
+EVisibility SSubsystemBrowserPanel::GetPerfStatusVisibility() const
+{
+	return USubsystemBrowserSettings::Get()->ShouldShowPerformanceStats() ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
 FSlateColor SSubsystemBrowserPanel::GetFilterStatusTextColor() const
 {
 	if (!SubsystemModel->IsSubsystemFilterActive())
@@ -624,11 +804,74 @@ TSharedRef<SWidget> SSubsystemBrowserPanel::GetViewOptionsButtonContent()
 			NAME_None,
 			EUserInterfaceActionType::ToggleButton
 		);
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("ToggleEditInAllPlayWorlds", "Edit In All Play Worlds"),
+			LOCTEXT("ToggleEditInAllPlayWorlds_Tooltip", "Display selected subsystem of every play world in details panel at once.\nValues that differ between worlds are shown as multiple values, a single edit applies to all instances."),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateUObject(Settings, &USubsystemBrowserSettings::ToggleEditInAllPlayWorlds),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateUObject(Settings, &USubsystemBrowserSettings::ShouldEditInAllPlayWorlds)
+			),
+			NAME_None,
+			EUserInterfaceActionType::ToggleButton
+		);
 	}
 	MenuBuilder.EndSection();
 
 	MenuBuilder.BeginSection(NAME_None, LOCTEXT("ViewOptionsGroup", "Options"));
 	{
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("CaptureSnapshot", "Capture Snapshot"),
+			LOCTEXT("CaptureSnapshot_Tooltip", "Save reflected state of all subsystems in current world into Saved/SubsystemBrowser/Snapshots.\nSubobjects are included when their display is enabled."),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::CaptureSnapshot))
+		);
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("CompareSnapshots", "Compare Snapshots"),
+			LOCTEXT("CompareSnapshots_Tooltip", "Open a view that lists subsystems and properties changed between two snapshots or current world."),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([WeakModel = TWeakPtr<FSubsystemModel>(SubsystemModel)]()
+			{
+				SSubsystemSnapshotDiffView::OpenWindow(WeakModel.Pin());
+			}))
+		);
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("CompareWorlds", "Compare Worlds"),
+			LOCTEXT("CompareWorlds_Tooltip", "Open a view that displays same subsystems of several worlds side by side and highlights differing values."),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([WeakModel = TWeakPtr<FSubsystemModel>(SubsystemModel)]()
+			{
+				SSubsystemWorldCompareView::OpenWindow(WeakModel.Pin());
+			}))
+		);
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("RecordTimeline", "Record Timeline"),
+			LOCTEXT("RecordTimeline_Tooltip", "Record state of selected subsystems into Saved/SubsystemBrowser/Timelines.\nRecording stops when toggled again or when play session ends, then recorded timeline is opened for scrubbing."),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::ToggleTimelineRecording),
+				FCanExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::CanToggleTimelineRecording),
+				FIsActionChecked::CreateSP(this, &SSubsystemBrowserPanel::IsRecordingTimeline)
+			),
+			NAME_None,
+			EUserInterfaceActionType::ToggleButton
+		);
+		MenuBuilder.AddSubMenu(
+			LOCTEXT("OpenTimelineMenu", "Open Timeline"),
+			LOCTEXT("OpenTimelineMenu_Tooltip", "Open previously recorded timeline for scrubbing."),
+			FNewMenuDelegate::CreateSP(this, &SSubsystemBrowserPanel::BuildTimelineOpenContent)
+		);
+		MenuBuilder.AddSubMenu(
+			LOCTEXT("ImportProfileMenu", "Import Profile"),
+			LOCTEXT("ImportProfileMenu_Tooltip", "Import csvprofile capture or Unreal Insights CSV export and display timings of subsystem scopes in Profiled ms and Calls columns."),
+			FNewMenuDelegate::CreateSP(this, &SSubsystemBrowserPanel::BuildProfileImportContent)
+		);
+		MenuBuilder.AddSubMenu(
+			LOCTEXT("ExportConfigMenu", "Export Config"),
+			LOCTEXT("ExportConfigMenu_Tooltip", "Export config sections of all subsystems or settings into a file."),
+			FNewMenuDelegate::CreateSP(this, &SSubsystemBrowserPanel::BuildConfigExportContent)
+		);
 		MenuBuilder.AddMenuEntry(
 			LOCTEXT("OpenSubsystemSettingsPanel", "Subsystem Settings"),
 			LOCTEXT("OpenSubsystemSettingsPanel_Tooltip", "Open subsystem settings panel."),
@@ -658,6 +901,426 @@ TSharedRef<SWidget> SSubsystemBrowserPanel::GetViewOptionsButtonContent()
 	return MenuBuilder.MakeWidget();
 }
 
+void SSubsystemBrowserPanel::BuildConfigExportContent(FMenuBuilder& MenuBuilder)
+{
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ExportSubsystemsModified", "Subsystems (Modified Properties)"),
+		LOCTEXT("ExportSubsystemsModified_Tooltip", "Export modified config properties of all subsystems in current world."),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::ExportConfigToFile, false, true))
+	);
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ExportSubsystemsAll", "Subsystems (All Properties)"),
+		LOCTEXT("ExportSubsystemsAll_Tooltip", "Export all config properties of all subsystems in current world."),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::ExportConfigToFile, false, false))
+	);
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ExportSettingsModified", "Settings (Modified Properties)"),
+		LOCTEXT("ExportSettingsModified_Tooltip", "Export modified config properties of all subsystem settings objects."),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::ExportConfigToFile, true, true))
+	);
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ExportSettingsAll", "Settings (All Properties)"),
+		LOCTEXT("ExportSettingsAll_Tooltip", "Export all config properties of all subsystem settings objects."),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::ExportConfigToFile, true, false))
+	);
+
+	MenuBuilder.BeginSection(NAME_None, LOCTEXT("CommitDefaultsGroup", "Default Config"));
+	{
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("CommitSubsystemsToDefaults", "Commit Subsystems to Defaults"),
+			LOCTEXT("CommitSubsystemsToDefaults_Tooltip", "Write current values of all DefaultConfig subsystems in current world into their default config files."),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::CommitConfigToDefaults, false))
+		);
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("CommitSettingsToDefaults", "Commit Settings to Defaults"),
+			LOCTEXT("CommitSettingsToDefaults_Tooltip", "Write current values of all DefaultConfig settings objects into their default config files."),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::CommitConfigToDefaults, true))
+		);
+	}
+	MenuBuilder.EndSection();
+}
+
+void SSubsystemBrowserPanel::ExportConfigToFile(bool bSettings, bool bModifiedOnly) const
+{
+	TArray<UObject*> Objects;
+	if (bSettings)
+	{
+		SubsystemModel->GetSettingsObjects(Objects);
+	}
+	else
+	{
+		SubsystemModel->GetConfigExportableSubsystems(Objects);
+	}
+
+	const FString FileName = FString::Printf(TEXT("%s-%s.ini"), bSettings ? TEXT("Settings") : TEXT("Subsystems"), *FDateTime::Now().ToString());
+	const FString FilePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SubsystemBrowser"), TEXT("Config"), FileName));
+
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 NumSections = FSubsystemBrowserUtils::ExportConfigToFile(Objects, FilePath, bModifiedOnly);
+	const double Duration = FPlatformTime::Seconds() - StartTime;
+
+	if (NumSections == INDEX_NONE)
+	{
+		FSubsystemBrowserUtils::ShowBrowserInfoMessage(
+			FText::Format(LOCTEXT("ExportConfigFailed", "Failed to write {0}"), FText::FromString(FilePath)),
+			SNotificationItem::CS_Fail);
+		return;
+	}
+
+	UE_LOG(LogSubsystemBrowser, Log, TEXT("Exported %d config sections to %s in %.2f ms"), NumSections, *FilePath, Duration * 1000.0);
+
+	FSubsystemBrowserUtils::ShowBrowserInfoMessage(
+		FText::Format(LOCTEXT("ExportConfigDone", "Exported {0} config sections to {1}"), FText::AsNumber(NumSections), FText::FromString(FilePath)),
+		SNotificationItem::CS_Success);
+}
+
+void SSubsystemBrowserPanel::CommitConfigToDefaults(bool bSettings) const
+{
+	if (FMessageDialog::Open(EAppMsgType::YesNo, LOCTEXT("CommitToDefaultsConfirm", "Are you sure you want to update the default config files?")) != EAppReturnType::Yes)
+	{
+		return;
+	}
+
+	TArray<UObject*> Objects;
+	if (bSettings)
+	{
+		SubsystemModel->GetSettingsObjects(Objects);
+	}
+	else
+	{
+		SubsystemModel->GetConfigExportableSubsystems(Objects);
+	}
+
+	const FSubsystemBrowserUtils::FDefaultConfigUpdateResult Result = FSubsystemBrowserUtils::UpdateDefaultConfigFiles(Objects);
+
+	for (const FString& FailedFile : Result.FailedFiles)
+	{
+		UE_LOG(LogSubsystemBrowser, Warning, TEXT("Failed to update default config %s"), *FailedFile);
+	}
+
+	if (Result.FailedFiles.Num())
+	{
+		FSubsystemBrowserUtils::ShowBrowserInfoMessage(
+			FText::Format(LOCTEXT("CommitToDefaultsFailed", "Failed to update {0} default config files, see log for details"), FText::AsNumber(Result.FailedFiles.Num())),
+			SNotificationItem::CS_Fail);
+		return;
+	}
+
+	FSubsystemBrowserUtils::ShowBrowserInfoMessage(
+		FText::Format(LOCTEXT("CommitToDefaultsDone", "Updated {0} objects, {1} default config files written"), FText::AsNumber(Result.NumObjects), FText::AsNumber(Result.NumFiles)),
+		SNotificationItem::CS_Success);
+}
+
+void SSubsystemBrowserPanel::CaptureSnapshot() const
+{
+	const FString FilePath = FSubsystemSnapshot::CaptureToDefaultFile(*SubsystemModel, USubsystemBrowserSettings::Get()->ShouldShowSubobjbects());
+	if (FilePath.IsEmpty())
+	{
+		FSubsystemBrowserUtils::ShowBrowserInfoMessage(LOCTEXT("CaptureSnapshotFailed", "Failed to save snapshot"), SNotificationItem::CS_Fail);
+		return;
+	}
+
+	UE_LOG(LogSubsystemBrowser, Log, TEXT("Subsystem snapshot saved to %s"), *FilePath);
+
+	FSubsystemBrowserUtils::ShowBrowserInfoMessage(
+		FText::Format(LOCTEXT("CaptureSnapshotDone", "Snapshot saved to {0}"), FText::FromString(FilePath)),
+		SNotificationItem::CS_Success);
+}
+
+bool SSubsystemBrowserPanel::IsRecordingTimeline() const
+{
+	return TimelineRecorder.IsValid() && TimelineRecorder->IsRecording();
+}
+
+void SSubsystemBrowserPanel::ToggleTimelineRecording()
+{
+	if (IsRecordingTimeline())
+	{
+		const FString FilePath = TimelineRecorder->GetFilePath();
+		TimelineRecorder.Reset();
+
+		OpenTimeline(FilePath);
+		return;
+	}
+
+	TArray<UObject*> Objects;
+	for (const SubsystemTreeItemPtr& Item : TreeWidget->GetSelectedItems())
+	{
+		if (Item->GetType() == ISubsystemTreeItem::EItemType::Category)
+			continue;
+
+		if (UObject* Object = Item->GetObjectForDetails())
+		{
+			Objects.AddUnique(Object);
+		}
+	}
+
+	const FString WorldName = GetNameSafe(SubsystemModel->GetCurrentWorld().Get());
+
+	TSharedPtr<FSubsystemTimelineRecorder> Recorder = MakeShared<FSubsystemTimelineRecorder>();
+	if (!Objects.Num() || !Recorder->Start(FSubsystemTimelineRecorder::MakeDefaultFilePath(WorldName), WorldName, Objects))
+	{
+		FSubsystemBrowserUtils::ShowBrowserInfoMessage(LOCTEXT("RecordTimelineFailed", "Failed to start timeline recording"), SNotificationItem::CS_Fail);
+		return;
+	}
+
+	TimelineRecorder = Recorder;
+}
+
+bool SSubsystemBrowserPanel::CanToggleTimelineRecording() const
+{
+	return IsRecordingTimeline() || TreeWidget->GetNumItemsSelected() > 0;
+}
+
+void SSubsystemBrowserPanel::BuildTimelineOpenContent(FMenuBuilder& MenuBuilder)
+{
+	TArray<FString> FileNames;
+	const FString Directory = FSubsystemTimelineRecorder::GetTimelineDirectory();
+	IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(Directory, TEXT("*.sbtl")), true, false);
+
+	// file names start with world name and timestamp, newest first within same world
+	FileNames.Sort([](const FString& A, const FString& B) { return A > B; });
+	for (const FString& FileName : FileNames)
+	{
+		const FString FilePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(Directory, FileName));
+		MenuBuilder.AddMenuEntry(
+			FText::FromString(FPaths::GetBaseFilename(FileName)),
+			FText::FromString(FilePath),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::OpenTimeline, FilePath))
+		);
+	}
+
+	if (!FileNames.Num())
+	{
+		MenuBuilder.AddMenuEntry(LOCTEXT("NoTimelines", "No recorded timelines"), FText::GetEmpty(), FSlateIcon(), FUIAction(FExecuteAction(), FCanExecuteAction::CreateLambda([]() { return false; })));
+	}
+}
+
+void SSubsystemBrowserPanel::OpenTimeline(FString InFilePath)
+{
+	CloseTimeline();
+
+	TimelineReader = FSubsystemTimelineReader::Open(InFilePath);
+	if (!TimelineReader.IsValid())
+	{
+		FSubsystemBrowserUtils::ShowBrowserInfoMessage(LOCTEXT("OpenTimelineFailed", "Failed to open timeline"), SNotificationItem::CS_Fail);
+		return;
+	}
+
+	FSubsystemBrowserUtils::ShowBrowserInfoMessage(
+		FText::Format(LOCTEXT("OpenTimelineDone", "Opened timeline of {0} with {1} objects"), FText::FromString(TimelineReader->GetWorldName()), FText::AsNumber(TimelineReader->GetObjects().Num())),
+		SNotificationItem::CS_Success);
+}
+
+void SSubsystemBrowserPanel::BuildProfileImportContent(FMenuBuilder& MenuBuilder)
+{
+	FSubsystemProfileImport& ProfileImport = FSubsystemBrowserModule::Get().GetProfileImport();
+
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ImportProfileBrowse", "Browse..."),
+		LOCTEXT("ImportProfileBrowse_Tooltip", "Select capture file to import."),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::BrowseProfileToImport))
+	);
+
+	if (ProfileImport.IsImporting() || ProfileImport.HasResults())
+	{
+		MenuBuilder.AddMenuEntry(
+			ProfileImport.IsImporting()
+				? FText::Format(LOCTEXT("ImportProfileCancel", "Cancel Import ({0})"), FText::AsPercent(ProfileImport.GetProgress()))
+				: LOCTEXT("ImportProfileClear", "Clear Imported Profile"),
+			FText::FromString(ProfileImport.GetFilePath()),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([]()
+			{
+				FSubsystemBrowserModule::Get().GetProfileImport().Reset();
+			}))
+		);
+	}
+
+	// csvprofile writes captures into Saved/Profiling/CSV, newest first
+	TArray<FString> FileNames;
+	const FString Directory = FPaths::Combine(FPaths::ProfilingDir(), TEXT("CSV"));
+	IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(Directory, TEXT("*.csv")), true, false);
+	FileNames.Sort([](const FString& A, const FString& B) { return A > B; });
+
+	if (FileNames.Num())
+	{
+		MenuBuilder.AddMenuSeparator();
+	}
+
+	for (const FString& FileName : FileNames)
+	{
+		const FString FilePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(Directory, FileName));
+		MenuBuilder.AddMenuEntry(
+			FText::FromString(FPaths::GetBaseFilename(FileName)),
+			FText::FromString(FilePath),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateSP(this, &SSubsystemBrowserPanel::ImportProfile, FilePath))
+		);
+	}
+}
+
+void SSubsystemBrowserPanel::BrowseProfileToImport()
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (!DesktopPlatform)
+		return;
+
+	TArray<FString> FilePaths;
+	const bool bOpened = DesktopPlatform->OpenFileDialog(
+		FSlateApplication::Get().FindBestParentWindowHandleForDialogs(AsShared()),
+		LOCTEXT("ImportProfileDialogTitle", "Import Profile").ToString(),
+		FPaths::ConvertRelativePathToFull(FPaths::ProfilingDir()),
+		TEXT(""),
+#if SB_WITH_TRACE_IMPORT
+		TEXT("Profile CSV (*.csv)|*.csv|Unreal Insights Trace (*.utrace)|*.utrace"),
+#else
+		TEXT("Profile CSV (*.csv)|*.csv"),
+#endif
+		EFileDialogFlags::None,
+		FilePaths);
+
+	if (bOpened && FilePaths.Num())
+	{
+		ImportProfile(FilePaths[0]);
+	}
+}
+
+void SSubsystemBrowserPanel::ImportProfile(FString InFilePath)
+{
+	TArray<UObject*> Objects;
+	for (const SubsystemTreeItemPtr& Item : SubsystemModel->GetAllSubsystems())
+	{
+		Objects.Add(Item->GetObjectForDetails());
+	}
+
+	TMap<FString, FName> ClassNames;
+	FSubsystemProfileImport::GatherClassNames(Objects, ClassNames);
+
+	if (!FSubsystemBrowserModule::Get().GetProfileImport().Start(InFilePath, ClassNames))
+	{
+		FSubsystemBrowserUtils::ShowBrowserInfoMessage(LOCTEXT("ImportProfileFailed", "Failed to import profile"), SNotificationItem::CS_Fail);
+		return;
+	}
+
+	UE_LOG(LogSubsystemBrowser, Log, TEXT("Importing profile %s"), *InFilePath);
+	bWaitingForProfileImport = true;
+}
+
+void SSubsystemBrowserPanel::OnProfileImportCompleted(bool bSuccess)
+{
+	if (bWaitingForProfileImport)
+	{
+		bWaitingForProfileImport = false;
+
+		const FSubsystemProfileImport& ProfileImport = FSubsystemBrowserModule::Get().GetProfileImport();
+		if (bSuccess)
+		{
+			FSubsystemBrowserUtils::ShowBrowserInfoMessage(
+				FText::Format(LOCTEXT("ImportProfileDone", "Imported timings of {0} subsystems"), FText::AsNumber(ProfileImport.GetNumMatched())),
+				SNotificationItem::CS_Success);
+		}
+		else
+		{
+			FSubsystemBrowserUtils::ShowBrowserInfoMessage(LOCTEXT("ImportProfileFailed", "Failed to import profile"), SNotificationItem::CS_Fail);
+		}
+	}
+
+	RequestSort();
+}
+
+void SSubsystemBrowserPanel::CloseTimeline()
+{
+	OnTimelineLiveClicked();
+	TimelineReader.Reset();
+}
+
+EVisibility SSubsystemBrowserPanel::GetTimelineVisibility() const
+{
+	return TimelineReader.IsValid() ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+float SSubsystemBrowserPanel::GetTimelineSliderValue() const
+{
+	if (!TimelineReader.IsValid() || !TimelineScrubFrame.IsSet() || TimelineReader->GetLastFrame() <= TimelineReader->GetFirstFrame())
+	{
+		return 1.f;
+	}
+
+	const uint64 FirstFrame = TimelineReader->GetFirstFrame();
+	return (float)((double)(TimelineScrubFrame.GetValue() - FirstFrame) / (double)(TimelineReader->GetLastFrame() - FirstFrame));
+}
+
+void SSubsystemBrowserPanel::OnTimelineSliderChanged(float InValue)
+{
+	if (!TimelineReader.IsValid())
+		return;
+
+	const uint64 FirstFrame = TimelineReader->GetFirstFrame();
+	const uint64 NumFrames = TimelineReader->GetLastFrame() - FirstFrame;
+	TimelineScrubFrame = FirstFrame + (uint64)FMath::RoundToDouble((double)NumFrames * FMath::Clamp(InValue, 0.f, 1.f));
+
+	UpdateTimelineFrameView();
+}
+
+FText SSubsystemBrowserPanel::GetTimelineFrameText() const
+{
+	if (!TimelineReader.IsValid())
+	{
+		return FText::GetEmpty();
+	}
+
+	if (!TimelineScrubFrame.IsSet())
+	{
+		return FText::Format(LOCTEXT("TimelineLiveFormat", "Live ({0} frames recorded)"), FText::AsNumber(TimelineReader->GetLastFrame() - TimelineReader->GetFirstFrame()));
+	}
+
+	return FText::Format(LOCTEXT("TimelineFrameFormat", "Frame {0}"), FText::AsNumber(TimelineScrubFrame.GetValue()));
+}
+
+FReply SSubsystemBrowserPanel::OnTimelineLiveClicked()
+{
+	// details view keeps displaying live state while scrubbing, switching back needs no refresh
+	TimelineScrubFrame.Reset();
+	TimelineFrameView->ClearFrame();
+	return FReply::Handled();
+}
+
+FReply SSubsystemBrowserPanel::OnTimelineCloseClicked()
+{
+	CloseTimeline();
+	return FReply::Handled();
+}
+
+void SSubsystemBrowserPanel::UpdateTimelineFrameView()
+{
+	SB_TRACE_SCOPE(SSubsystemBrowserPanel::UpdateTimelineFrameView);
+
+	SubsystemTreeItemPtr Selected = GetFirstSelectedItem();
+	const FSubsystemTreeObjectItem* ObjectItem = Selected.IsValid() ? Selected->GetAsObjectDescriptor() : nullptr;
+	const UClass* Class = ObjectItem ? ObjectItem->ObjectClass.Get() : nullptr;
+
+	// live instance may be gone already, recorded object is then matched by class
+	const int32 ObjectIndex = Class ? TimelineReader->FindObject(Class->GetPathName(), GetNameSafe(ObjectItem->Object.Get())) : INDEX_NONE;
+
+	TArray<TOptional<FString>> Values;
+	if (ObjectIndex == INDEX_NONE || !TimelineReader->GetObjectState(ObjectIndex, TimelineScrubFrame.GetValue(), Values))
+	{
+		TimelineFrameView->ClearFrame();
+		return;
+	}
+
+	TimelineFrameView->SetFrame(TimelineReader->GetObjects()[ObjectIndex], TimelineScrubFrame.GetValue(), Values);
+}
+
 void SSubsystemBrowserPanel::BuildColumnPickerContent(FMenuBuilder& MenuBuilder)
 {
 	USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
@@ -723,7 +1386,25 @@ void SSubsystemBrowserPanel::SetupColumns(SHeaderRow& HeaderRow)
 {
 	HeaderRow.ClearColumns();
 
-	for (const SubsystemColumnPtr& Column : SubsystemModel->GetSelectedTableColumns())
+	TArray<SubsystemColumnPtr> SelectedColumns = SubsystemModel->GetSelectedTableColumns();
+	for (const SubsystemColumnPtr& Column : DisplayedColumns)
+	{
+		if (!SelectedColumns.Contains(Column))
+		{
+			Column->OnDisplayStateChanged(false);
+		}
+	}
+
+	for (const SubsystemColumnPtr& Column : SelectedColumns)
+	{
+		if (!DisplayedColumns.Contains(Column))
+		{
+			Column->OnDisplayStateChanged(true);
+		}
+	}
+	DisplayedColumns = MoveTemp(SelectedColumns);
+
+	for (const SubsystemColumnPtr& Column : DisplayedColumns)
 	{
 		auto ColumnArgs = Column->GenerateHeaderColumnWidget();
 
@@ -826,10 +1507,10 @@ void SSubsystemBrowserPanel::ToggleTableColoring()
 
 void SSubsystemBrowserPanel::ToggleForceHiddenPropertyVisibility()
 {
+	// details view is updated by settings change notification
 	USubsystemBrowserSettings::Get()->ToggleForceHiddenPropertyVisibility();
 
 	RefreshView();
-	RecreateDetails();
 }
 
 void SSubsystemBrowserPanel::ToggleShowSubobjects()
@@ -990,6 +1671,12 @@ void SSubsystemBrowserPanel::HandlePIEEnd(const bool bIsSimulating)
 {
 	UE_LOG(LogSubsystemBrowser, Verbose, TEXT("On PIE End"));
 
+	// recorded objects are about to be destroyed
+	if (IsRecordingTimeline())
+	{
+		ToggleTimelineRecording();
+	}
+
 	if (USubsystemBrowserSettings::Get()->ShouldDisplayAllWorlds() && PrePieSelectedWorld.IsValid())
 	{
 		OnSelectWorld(PrePieSelectedWorld.Get());
@@ -1022,6 +1709,17 @@ void SSubsystemBrowserPanel::HandleWorldChange(UWorld* InWorld)
 	}
 }
 
+uint32 SSubsystemBrowserPanel::GetDetailsViewKey() const
+{
+	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
+
+	// only settings that are consumed by FDetailsViewArgs require a separate view instance,
+	// anything else is evaluated by delegates and needs a refresh only
+	uint32 Key = 0;
+	Key |= Settings->ShouldForceHiddenPropertyVisibility() ? 1 << 0 : 0;
+	return Key;
+}
+
 TSharedRef<IDetailsView> SSubsystemBrowserPanel::CreateDetails()
 {
 	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
@@ -1052,22 +1750,46 @@ TSharedRef<IDetailsView> SSubsystemBrowserPanel::CreateDetails()
 			FOnGetDetailCustomizationInstance::CreateStatic(&FSBDetailsCustomization::MakeForSettings));
 	}
 
-	if (Settings->ShouldUseCustomPropertyFilteringInBrowser())
-	{
-		DetailViewWidget->SetIsPropertyVisibleDelegate(FIsPropertyVisible::CreateSP(this, &SSubsystemBrowserPanel::IsDetailsPropertyVisible));
-		DetailViewWidget->SetIsPropertyReadOnlyDelegate(FIsPropertyReadOnly::CreateSP(this, &SSubsystemBrowserPanel::IsDetailsPropertyReadOnly));
-	}
+	// Filtering delegates are always bound and check settings on their own,
+	// so toggling custom filtering does not require a new view instance
+	DetailViewWidget->SetIsPropertyVisibleDelegate(FIsPropertyVisible::CreateSP(this, &SSubsystemBrowserPanel::IsDetailsPropertyVisible));
+	DetailViewWidget->SetIsPropertyReadOnlyDelegate(FIsPropertyReadOnly::CreateSP(this, &SSubsystemBrowserPanel::IsDetailsPropertyReadOnly));
 
 	FSubsystemBrowserModule::OnCustomizeDetailsView.Broadcast(DetailViewWidget, TEXT("SubsystemBrowserPanel"));
 
 	return DetailViewWidget;
 }
 
-void SSubsystemBrowserPanel::RecreateDetails()
+TSharedRef<IDetailsView> SSubsystemBrowserPanel::AcquireDetails(uint32 InKey)
+{
+	const TSharedRef<IDetailsView>* Existing = DetailsViewPool.Find(InKey);
+	FSubsystemBrowserTrace::RecordCacheAccess(FSubsystemBrowserTrace::ECache::DetailsPool, Existing != nullptr);
+	if (Existing)
+	{
+		return *Existing;
+	}
+
+	SB_TRACE_SCOPE(SSubsystemBrowserPanel::CreateDetails);
+
+	TSharedRef<IDetailsView> NewDetails = CreateDetails();
+	DetailsViewPool.Add(InKey, NewDetails);
+	return NewDetails;
+}
+
+void SSubsystemBrowserPanel::UpdateDetailsView()
 {
+	const uint32 NewKey = GetDetailsViewKey();
+	if (DetailsView.IsValid() && NewKey == DetailsViewKey)
+	{
+		// Same construction arguments, reevaluate filtering delegates only
+		RefreshDetails();
+		return;
+	}
+
 	TSharedPtr<IDetailsView> ExistingDetails = DetailsView;
 
-	DetailsView = CreateDetails();
+	DetailsViewKey = NewKey;
+	DetailsView = AcquireDetails(NewKey);
 
 #if UE_VERSION_OLDER_THAN(5, 0, 0)
 	DetailsViewBox->ClearChildren();
@@ -1076,13 +1798,21 @@ void SSubsystemBrowserPanel::RecreateDetails()
 	DetailsViewBox->GetSlot(0) [ DetailsView.ToSharedRef() ];
 #endif
 
-	// Copy other props from existing details ?
-	ExistingDetails.Reset();
+	// Pooled view stays alive but should not keep tracking previous selection
+	if (ExistingDetails.IsValid() && ExistingDetails != DetailsView)
+	{
+		ExistingDetails->SetObject(nullptr);
+	}
+
+	// Carry over current selection to the new view
+	SubsystemTreeItemPtr Selected = GetFirstSelectedItem();
+	PendingSelectionObject = Selected.IsValid() ? Selected->GetObjectForDetails() : nullptr;
+	RefreshDetails();
 }
 
 void SSubsystemBrowserPanel::SetSelectedObject(SubsystemTreeItemPtr Item)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(SSubsystemBrowserPanel::SetSelectedObject);
+	SB_TRACE_SCOPE(SSubsystemBrowserPanel::SetSelectedObject);
 
 	UObject* InObject = Item.IsValid() ? Item->GetObjectForDetails() : nullptr;
 	UE_LOG(LogSubsystemBrowser, Log, TEXT("Selected object %s"), *GetNameSafe(InObject));
@@ -1094,11 +1824,16 @@ void SSubsystemBrowserPanel::SetSelectedObject(SubsystemTreeItemPtr Item)
 		PendingSelectionObject = InObject;
 		RefreshDetails();
 	}
+
+	if (TimelineScrubFrame.IsSet())
+	{
+		UpdateTimelineFrameView();
+	}
 }
 
 void SSubsystemBrowserPanel::ResetSelectedObject()
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(SSubsystemBrowserPanel::ResetSelectedObject);
+	SB_TRACE_SCOPE(SSubsystemBrowserPanel::ResetSelectedObject);
 
 	UE_LOG(LogSubsystemBrowser, Log, TEXT("Reset selected object"));
 
@@ -1113,6 +1848,12 @@ void SSubsystemBrowserPanel::ResetSelectedObject()
 
 bool SSubsystemBrowserPanel::IsDetailsPropertyVisible(const FPropertyAndParent& InProperty) const
 {
+	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
+	if (!Settings->ShouldUseCustomPropertyFilteringInBrowser())
+	{
+		return true;
+	}
+
 	static const FName NAME_Hidden(TEXT("Hidden"));
 	
 	const FProperty* Property = InProperty.ParentProperties.Num() > 0 ? InProperty.ParentProperties.Last() : &InProperty.Property;
@@ -1128,8 +1869,6 @@ bool SSubsystemBrowserPanel::IsDetailsPropertyVisible(const FPropertyAndParent&
 		return false;
 	}
 
-	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
-
 	if (Settings->ShouldShowAnyProperties())
 	{
 		return true;
@@ -1141,9 +1880,20 @@ bool SSubsystemBrowserPanel::IsDetailsPropertyVisible(const FPropertyAndParent&
 
 bool SSubsystemBrowserPanel::IsDetailsPropertyReadOnly(const FPropertyAndParent& InProperty) const
 {
+	// recorded state is for inspection only
+	if (TimelineScrubFrame.IsSet())
+	{
+		return true;
+	}
+
 	const FProperty* Property = InProperty.ParentProperties.Num() > 0 ? InProperty.ParentProperties.Last() : &InProperty.Property;
 
 	const USubsystemBrowserSettings* Settings = USubsystemBrowserSettings::Get();
+	if (!Settings->ShouldUseCustomPropertyFilteringInBrowser())
+	{
+		return false;
+	}
+
 	if (Settings->ShouldEditAnyProperties())
 	{
 		return false;
@@ -1263,7 +2013,7 @@ void SSubsystemBrowserPanel::OnSettingsChanged(FName InPropertyName)
 		bFullRefresh = true;
 		RefreshView();
 		RefreshColumns();
-		RecreateDetails();
+		UpdateDetailsView();
 		ResetParentsExpansionState();
 		return;
 	}
@@ -1281,7 +2031,7 @@ void SSubsystemBrowserPanel::OnSettingsChanged(FName InPropertyName)
 		}
 		if (Property->HasMetaData(FSubsystemBrowserConfigMeta::MD_ConfigAffectsDetails))
 		{
-			RecreateDetails();
+			UpdateDetailsView();
 		}
 	}
 }
@@ -1293,7 +2043,17 @@ void SSubsystemBrowserPanel::OnModulesChanged(FName ModuleThatChanged, EModuleCh
 
 void SSubsystemBrowserPanel::OnSubsystemDataChanged(TSharedRef<ISubsystemTreeItem> Item)
 {
-	RefreshView();
+	// row widgets read values and highlight through attributes, so only order may need an update
+	if (SortMode != EColumnSortMode::None && TreeItemMap.Contains(Item->GetID()))
+	{
+		bSortDirty = true;
+	}
+}
+
+void SSubsystemBrowserPanel::OnRetainedGraphUpdated()
+{
+	// analysis nodes rebuild their children from latest results when asked for them
+	TreeWidget->RequestTreeRefresh();
 }
 
 EColumnSortMode::Type SSubsystemBrowserPanel::GetColumnSortMode(FName ColumnId) const
@@ -1329,6 +2089,10 @@ void SSubsystemBrowserPanel::SortItems(TArray<SubsystemTreeItemPtr>& Items) cons
 	auto Column = SubsystemModel->FindTableColumn(SortByColumn);
 	if (Column.IsValid() && Column->SupportsSorting())
 	{
+		SB_TRACE_STAT_SCOPE(SSubsystemBrowserPanel::SortItems, STAT_SubsystemBrowser_ModelSort);
+		FSubsystemPerfStats::FScope PerfScope(SubsystemModel->GetPerfStats(), ESubsystemPerfMetric::Sort);
+		PerfScope.SetNumItems(Items.Num());
+
 		Column->SortItems(Items, SortMode);
 	}
 }
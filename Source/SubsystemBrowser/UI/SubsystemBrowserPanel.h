@@ -12,6 +12,9 @@
 #include "Model/SubsystemBrowserModel.h"
 
 class SComboButton;
+class FSubsystemTimelineRecorder;
+class FSubsystemTimelineReader;
+class SSubsystemTimelineFrameView;
 struct FPropertyAndParent;
 class IDetailsView;
 class ITableRow;
@@ -55,6 +58,9 @@ protected:
 	FText GetSearchBoxText() const;
 	FText GetFilterStatusText() const;
 	FSlateColor GetFilterStatusTextColor() const;
+	FText GetPerfStatusText() const;
+	FText GetPerfStatusTooltipText() const;
+	EVisibility GetPerfStatusVisibility() const;
 
 	// View options panel
 
@@ -90,8 +96,38 @@ protected:
 	void ToggleShouldShowOnlyViewable();
 
 	void ShowPluginSettingsTab() const;
+	void BuildConfigExportContent(FMenuBuilder& MenuBuilder);
+	void ExportConfigToFile(bool bSettings, bool bModifiedOnly) const;
+	void CommitConfigToDefaults(bool bSettings) const;
+	void CaptureSnapshot() const;
 	void ShowSubsystemSettingsTab() const;
 
+	// Timeline
+
+	bool IsRecordingTimeline() const;
+	bool CanToggleTimelineRecording() const;
+	void ToggleTimelineRecording();
+	void BuildTimelineOpenContent(FMenuBuilder& MenuBuilder);
+	void OpenTimeline(FString InFilePath);
+	void CloseTimeline();
+
+	EVisibility GetTimelineVisibility() const;
+	float GetTimelineSliderValue() const;
+	void OnTimelineSliderChanged(float InValue);
+	FText GetTimelineFrameText() const;
+	FReply OnTimelineLiveClicked();
+	FReply OnTimelineCloseClicked();
+	/* display recorded state of selected subsystem at scrubbed frame */
+	void UpdateTimelineFrameView();
+	int32 GetDetailsWidgetIndex() const { return TimelineScrubFrame.IsSet() ? 1 : 0; }
+
+	// Profile import
+
+	void BuildProfileImportContent(FMenuBuilder& MenuBuilder);
+	void BrowseProfileToImport();
+	void ImportProfile(FString InFilePath);
+	void OnProfileImportCompleted(bool bSuccess);
+
 	FReply RequestRefresh();
 
 	// Selection and Expansion
@@ -118,8 +154,10 @@ protected:
 
 	// Details
 
+	uint32 GetDetailsViewKey() const;
 	TSharedRef<IDetailsView> CreateDetails();
-	void RecreateDetails();
+	TSharedRef<IDetailsView> AcquireDetails(uint32 InKey);
+	void UpdateDetailsView();
 	void SetSelectedObject(SubsystemTreeItemPtr Item);
 	void ResetSelectedObject();
 
@@ -139,11 +177,16 @@ protected:
 
 	void OnModulesChanged(FName ModuleThatChanged, EModuleChangeReason ReasonForChange);
 	void OnSubsystemDataChanged(TSharedRef<ISubsystemTreeItem> Item);
+	void OnRetainedGraphUpdated();
 
 private:
 	TSharedPtr<FSubsystemModel> SubsystemModel;
 
 	TSharedPtr<IDetailsView>	DetailsView;
+	/** Details views created so far, keyed by construction arguments they were created with */
+	TMap<uint32, TSharedRef<IDetailsView>> DetailsViewPool;
+	/** Key of currently displayed details view */
+	uint32						DetailsViewKey = 0;
 	TSharedPtr<SVerticalBox>	DetailsViewBox;
 	TSharedPtr<SVerticalBox>	VerticalBox;
 	TSharedPtr<SBorder>			VerticalBoxBorder;
@@ -158,6 +201,8 @@ private:
 	TSharedPtr<SSubsystemsHeaderRow> HeaderRowWidget;
 
 	TArray<SubsystemColumnPtr> DynamicColumnSlots;
+	/* columns currently added to header row, notified when they are removed */
+	TArray<SubsystemColumnPtr> DisplayedColumns;
 
 	/** Root items for the tree widget */
 	TArray<SubsystemTreeItemPtr> RootTreeItems;
@@ -187,4 +232,14 @@ private:
 	bool bSortDirty = false;
 	//
 	TWeakObjectPtr<UWorld> PrePieSelectedWorld;
+
+	TSharedPtr<FSubsystemTimelineRecorder> TimelineRecorder;
+	TSharedPtr<FSubsystemTimelineReader> TimelineReader;
+	/* frame displayed instead of details view, unset while showing live state */
+	TOptional<uint64> TimelineScrubFrame;
+	/* read-only recorded values of selected subsystem */
+	TSharedPtr<SSubsystemTimelineFrameView> TimelineFrameView;
+
+	/* was profile import started from this panel */
+	bool bWaitingForProfileImport = false;
 };
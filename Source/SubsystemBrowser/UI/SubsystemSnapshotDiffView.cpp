@@ -0,0 +1,367 @@
+// Copyright 2022, Aquanox.
+
+#include "UI/SubsystemSnapshotDiffView.h"
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserSettings.h"
+#include "SubsystemBrowserStyle.h"
+#include "Model/SubsystemBrowserModel.h"
+#include "Model/SubsystemBrowserSnapshot.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Widgets/SWindow.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SComboBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SExpanderArrow.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SubsystemBrowser"
+
+namespace SubsystemSnapshotDiffView
+{
+	static const FName ColumnName_Name = TEXT("Name");
+	static const FName ColumnName_Base = TEXT("Base");
+	static const FName ColumnName_Target = TEXT("Target");
+
+	static FSlateColor GetChangeColor(ESubsystemSnapshotChange InChange)
+	{
+		switch (InChange)
+		{
+		case ESubsystemSnapshotChange::Added: return FSlateColor(FLinearColor(0.2f, 0.8f, 0.2f));
+		case ESubsystemSnapshotChange::Removed: return FSlateColor(FLinearColor(0.9f, 0.25f, 0.25f));
+		default: return FSlateColor::UseForeground();
+		}
+	}
+}
+
+/**
+ * Row of snapshot diff tree
+ */
+class SSubsystemSnapshotDiffRow : public SMultiColumnTableRow<SubsystemSnapshotDiffItemPtr>
+{
+	using Super = SMultiColumnTableRow<SubsystemSnapshotDiffItemPtr>;
+public:
+	SLATE_BEGIN_ARGS(SSubsystemSnapshotDiffRow)
+		{}
+		SLATE_ARGUMENT(SubsystemSnapshotDiffItemPtr, Item)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+	{
+		Item = InArgs._Item;
+		Super::Construct(Super::FArguments(), InOwnerTableView);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+	{
+		using namespace SubsystemSnapshotDiffView;
+
+		if (ColumnName == ColumnName_Name)
+		{
+			return SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				[
+					SNew(SExpanderArrow, SharedThis(this))
+				]
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.f)
+				.VAlign(VAlign_Center)
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(Item->Name))
+					.ColorAndOpacity(GetChangeColor(Item->Change))
+				];
+		}
+
+		const FString& Value = ColumnName == ColumnName_Base ? Item->BaseValue : Item->TargetValue;
+		return SNew(STextBlock)
+			.Text(FText::FromString(Value))
+			.ToolTipText(FText::FromString(Value));
+	}
+
+private:
+	SubsystemSnapshotDiffItemPtr Item;
+};
+
+void SSubsystemSnapshotDiffView::Construct(const FArguments& InArgs)
+{
+	using namespace SubsystemSnapshotDiffView;
+
+	Model = InArgs._InModel;
+
+	RefreshSources();
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SBorder)
+			.BorderImage(FStyleHelper::GetBrush(TEXT("ToolPanel.GroupBorder")))
+			[
+				SNew(SHorizontalBox)
+
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.f)
+				.Padding(2)
+				[
+					SNew(SComboBox<TSharedPtr<FString>>)
+					.OptionsSource(&Sources)
+					.OnGenerateWidget(this, &SSubsystemSnapshotDiffView::OnGenerateSourceWidget)
+					.OnSelectionChanged(this, &SSubsystemSnapshotDiffView::OnBaseSourceSelected)
+					.InitiallySelectedItem(BaseSource)
+					[
+						SNew(STextBlock)
+						.Text(this, &SSubsystemSnapshotDiffView::GetBaseSourceText)
+					]
+				]
+
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.f)
+				.Padding(2)
+				[
+					SNew(SComboBox<TSharedPtr<FString>>)
+					.OptionsSource(&Sources)
+					.OnGenerateWidget(this, &SSubsystemSnapshotDiffView::OnGenerateSourceWidget)
+					.OnSelectionChanged(this, &SSubsystemSnapshotDiffView::OnTargetSourceSelected)
+					.InitiallySelectedItem(TargetSource)
+					[
+						SNew(STextBlock)
+						.Text(this, &SSubsystemSnapshotDiffView::GetTargetSourceText)
+					]
+				]
+
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(2)
+				[
+					SNew(SButton)
+					.Text(LOCTEXT("SnapshotDiffCompare", "Compare"))
+					.OnClicked(this, &SSubsystemSnapshotDiffView::OnCompareClicked)
+				]
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0, 2)
+		[
+			SNew(SSearchBox)
+			.HintText(LOCTEXT("SnapshotDiffFilterHint", "Search Subsystems or Properties"))
+			.OnTextChanged(this, &SSubsystemSnapshotDiffView::SetFilterText)
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SAssignNew(TreeView, STreeView<SubsystemSnapshotDiffItemPtr>)
+			.TreeItemsSource(&RootItems)
+			.SelectionMode(ESelectionMode::Single)
+			.OnGenerateRow(this, &SSubsystemSnapshotDiffView::OnGenerateRow)
+			.OnGetChildren(this, &SSubsystemSnapshotDiffView::OnGetChildren)
+			.HeaderRow
+			(
+				SNew(SHeaderRow)
+				+ SHeaderRow::Column(ColumnName_Name)
+				.DefaultLabel(LOCTEXT("SnapshotDiffColumnName", "Name"))
+				.FillWidth(0.4f)
+				+ SHeaderRow::Column(ColumnName_Base)
+				.DefaultLabel(LOCTEXT("SnapshotDiffColumnBase", "Base"))
+				.FillWidth(0.3f)
+				+ SHeaderRow::Column(ColumnName_Target)
+				.DefaultLabel(LOCTEXT("SnapshotDiffColumnTarget", "Target"))
+				.FillWidth(0.3f)
+			)
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2)
+		[
+			SNew(STextBlock)
+			.Text(this, &SSubsystemSnapshotDiffView::GetStatusText)
+		]
+	];
+}
+
+void SSubsystemSnapshotDiffView::OpenWindow(TSharedPtr<FSubsystemModel> InModel)
+{
+	TSharedRef<SWindow> Window = SNew(SWindow)
+		.Title(LOCTEXT("SnapshotDiffWindowTitle", "Subsystem Snapshot Diff"))
+		.ClientSize(FVector2D(900, 600))
+		[
+			SNew(SSubsystemSnapshotDiffView)
+			.InModel(InModel)
+		];
+
+	FSlateApplication::Get().AddWindow(Window);
+}
+
+void SSubsystemSnapshotDiffView::RefreshSources()
+{
+	Sources.Reset();
+
+	LiveSource = MakeShared<FString>();
+	Sources.Add(LiveSource);
+
+	TArray<FString> FileNames;
+	const FString Directory = FSubsystemSnapshot::GetSnapshotDirectory();
+	IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(Directory, TEXT("*.sbsnap")), true, false);
+
+	// file names start with world name and timestamp, newest first within same world
+	FileNames.Sort([](const FString& A, const FString& B) { return A > B; });
+	for (const FString& FileName : FileNames)
+	{
+		Sources.Add(MakeShared<FString>(FPaths::Combine(Directory, FileName)));
+	}
+
+	BaseSource = Sources.Num() > 1 ? Sources[1] : LiveSource;
+	TargetSource = LiveSource;
+}
+
+TSharedPtr<FSubsystemSnapshot> SSubsystemSnapshotDiffView::LoadSource(const TSharedPtr<FString>& InSource) const
+{
+	if (InSource == LiveSource)
+	{
+		TSharedPtr<FSubsystemModel> ModelPtr = Model.Pin();
+		if (!ModelPtr.IsValid())
+		{
+			return nullptr;
+		}
+		return FSubsystemSnapshot::Capture(*ModelPtr, USubsystemBrowserSettings::Get()->ShouldShowSubobjbects());
+	}
+
+	return InSource.IsValid() ? FSubsystemSnapshot::LoadFromFile(*InSource) : nullptr;
+}
+
+TSharedRef<SWidget> SSubsystemSnapshotDiffView::OnGenerateSourceWidget(TSharedPtr<FString> InSource) const
+{
+	return SNew(STextBlock).Text(GetSourceText(InSource));
+}
+
+void SSubsystemSnapshotDiffView::OnBaseSourceSelected(TSharedPtr<FString> InSource, ESelectInfo::Type SelectInfo)
+{
+	BaseSource = InSource;
+}
+
+void SSubsystemSnapshotDiffView::OnTargetSourceSelected(TSharedPtr<FString> InSource, ESelectInfo::Type SelectInfo)
+{
+	TargetSource = InSource;
+}
+
+FText SSubsystemSnapshotDiffView::GetSourceText(TSharedPtr<FString> InSource) const
+{
+	if (InSource == LiveSource)
+	{
+		return LOCTEXT("SnapshotDiffLiveSource", "Current World");
+	}
+	return InSource.IsValid() ? FText::FromString(FPaths::GetBaseFilename(*InSource)) : FText::GetEmpty();
+}
+
+FReply SSubsystemSnapshotDiffView::OnCompareClicked()
+{
+	TSharedPtr<FSubsystemSnapshot> Base = LoadSource(BaseSource);
+	TSharedPtr<FSubsystemSnapshot> Target = LoadSource(TargetSource);
+
+	bHasDiff = Base.IsValid() && Target.IsValid();
+	if (bHasDiff)
+	{
+		Diff = FSubsystemSnapshotDiff::Compute(*Base, *Target);
+	}
+	else
+	{
+		Diff = FSubsystemSnapshotDiff();
+	}
+
+	RebuildTree();
+	return FReply::Handled();
+}
+
+void SSubsystemSnapshotDiffView::SetFilterText(const FText& InFilterText)
+{
+	FilterString = InFilterText.ToString().TrimStartAndEnd();
+	RebuildTree();
+}
+
+void SSubsystemSnapshotDiffView::RebuildTree()
+{
+	RootItems.Reset();
+
+	const bool bFilterActive = !FilterString.IsEmpty();
+
+	for (const FSubsystemSnapshotObjectDiff& ObjectDiff : Diff.Objects)
+	{
+		SubsystemSnapshotDiffItemPtr ObjectItem = MakeShared<FSubsystemSnapshotDiffItem>();
+		ObjectItem->Name = ObjectDiff.ParentName.IsEmpty()
+			? FString::Printf(TEXT("%s (%s)"), *ObjectDiff.Name, *ObjectDiff.Category)
+			: FString::Printf(TEXT("%s.%s (%s)"), *ObjectDiff.ParentName, *ObjectDiff.Name, *ObjectDiff.Category);
+		ObjectItem->BaseValue = ObjectDiff.Change != ESubsystemSnapshotChange::Added ? ObjectDiff.ClassPath : FString();
+		ObjectItem->TargetValue = ObjectDiff.Change != ESubsystemSnapshotChange::Removed ? ObjectDiff.ClassPath : FString();
+		ObjectItem->Change = ObjectDiff.Change;
+
+		const bool bObjectPasses = !bFilterActive
+			|| ObjectItem->Name.Contains(FilterString)
+			|| ObjectDiff.ClassPath.Contains(FilterString);
+
+		for (const FSubsystemSnapshotPropertyDiff& PropertyDiff : ObjectDiff.Properties)
+		{
+			if (!bObjectPasses && !PropertyDiff.Path.Contains(FilterString))
+			{
+				continue;
+			}
+
+			SubsystemSnapshotDiffItemPtr PropertyItem = MakeShared<FSubsystemSnapshotDiffItem>();
+			PropertyItem->Name = PropertyDiff.Path;
+			PropertyItem->BaseValue = PropertyDiff.BaseValue;
+			PropertyItem->TargetValue = PropertyDiff.TargetValue;
+			PropertyItem->Change = PropertyDiff.Change;
+			ObjectItem->Children.Add(PropertyItem);
+		}
+
+		if (bObjectPasses || ObjectItem->Children.Num())
+		{
+			RootItems.Add(ObjectItem);
+		}
+	}
+
+	if (TreeView.IsValid())
+	{
+		for (const SubsystemSnapshotDiffItemPtr& Item : RootItems)
+		{
+			TreeView->SetItemExpansion(Item, true);
+		}
+		TreeView->RequestTreeRefresh();
+	}
+}
+
+FText SSubsystemSnapshotDiffView::GetStatusText() const
+{
+	if (!bHasDiff)
+	{
+		return LOCTEXT("SnapshotDiffNoResult", "Select two snapshots and press Compare");
+	}
+
+	return FText::Format(LOCTEXT("SnapshotDiffStatus", "{0} changed, {1} unchanged"),
+		FText::AsNumber(Diff.Objects.Num()), FText::AsNumber(Diff.NumUnchanged));
+}
+
+TSharedRef<ITableRow> SSubsystemSnapshotDiffView::OnGenerateRow(SubsystemSnapshotDiffItemPtr InItem, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SSubsystemSnapshotDiffRow, OwnerTable)
+		.Item(InItem);
+}
+
+void SSubsystemSnapshotDiffView::OnGetChildren(SubsystemSnapshotDiffItemPtr InItem, TArray<SubsystemSnapshotDiffItemPtr>& OutChildren)
+{
+	OutChildren = InItem->Children;
+}
+
+#undef LOCTEXT_NAMESPACE
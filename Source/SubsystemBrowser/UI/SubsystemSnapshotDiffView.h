@@ -0,0 +1,81 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreFwd.h"
+#include "SlateFwd.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/STreeView.h"
+#include "Model/SubsystemBrowserSnapshotDiff.h"
+
+class FSubsystemModel;
+class FSubsystemSnapshot;
+class ITableRow;
+
+/**
+ * Row of snapshot diff tree, either changed object or one of its changed properties
+ */
+struct FSubsystemSnapshotDiffItem
+{
+	FString Name;
+	FString BaseValue;
+	FString TargetValue;
+	ESubsystemSnapshotChange Change = ESubsystemSnapshotChange::Modified;
+
+	TArray<TSharedPtr<FSubsystemSnapshotDiffItem>> Children;
+};
+
+using SubsystemSnapshotDiffItemPtr = TSharedPtr<FSubsystemSnapshotDiffItem>;
+
+/**
+ * Widget that compares two subsystem snapshots and displays changed objects and properties as a tree
+ */
+class SSubsystemSnapshotDiffView : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SSubsystemSnapshotDiffView)
+		{}
+		/** Model used to capture live state */
+		SLATE_ARGUMENT(TSharedPtr<FSubsystemModel>, InModel)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/* Open diff view in a new window */
+	static void OpenWindow(TSharedPtr<FSubsystemModel> InModel);
+
+private:
+	void RefreshSources();
+	TSharedPtr<FSubsystemSnapshot> LoadSource(const TSharedPtr<FString>& InSource) const;
+
+	TSharedRef<SWidget> OnGenerateSourceWidget(TSharedPtr<FString> InSource) const;
+	void OnBaseSourceSelected(TSharedPtr<FString> InSource, ESelectInfo::Type SelectInfo);
+	void OnTargetSourceSelected(TSharedPtr<FString> InSource, ESelectInfo::Type SelectInfo);
+	FText GetSourceText(TSharedPtr<FString> InSource) const;
+	FText GetBaseSourceText() const { return GetSourceText(BaseSource); }
+	FText GetTargetSourceText() const { return GetSourceText(TargetSource); }
+	FReply OnCompareClicked();
+
+	void SetFilterText(const FText& InFilterText);
+	void RebuildTree();
+	FText GetStatusText() const;
+
+	TSharedRef<ITableRow> OnGenerateRow(SubsystemSnapshotDiffItemPtr InItem, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnGetChildren(SubsystemSnapshotDiffItemPtr InItem, TArray<SubsystemSnapshotDiffItemPtr>& OutChildren);
+
+private:
+	TWeakPtr<FSubsystemModel> Model;
+
+	/* Snapshot file paths, first entry stands for live capture */
+	TArray<TSharedPtr<FString>> Sources;
+	TSharedPtr<FString> LiveSource;
+	TSharedPtr<FString> BaseSource;
+	TSharedPtr<FString> TargetSource;
+
+	FSubsystemSnapshotDiff Diff;
+	bool bHasDiff = false;
+	FString FilterString;
+
+	TArray<SubsystemSnapshotDiffItemPtr> RootItems;
+	TSharedPtr<STreeView<SubsystemSnapshotDiffItemPtr>> TreeView;
+};
@@ -0,0 +1,74 @@
+// Copyright 2022, Aquanox.
+
+#include "UI/SubsystemSparkline.h"
+
+#include "SubsystemBrowserTrace.h"
+#include "Model/SubsystemBrowserPropertyWatch.h"
+#include "Rendering/DrawElements.h"
+
+namespace SubsystemSparkline
+{
+	static const FLinearColor LineColors[] =
+	{
+		FLinearColor(0.2f, 0.8f, 0.3f),
+		FLinearColor(0.9f, 0.6f, 0.1f),
+		FLinearColor(0.3f, 0.6f, 1.0f),
+		FLinearColor(0.9f, 0.3f, 0.6f),
+	};
+}
+
+void SSubsystemSparkline::Construct(const FArguments& InArgs, FSubsystemPropertyWatcher& InWatcher)
+{
+	Watcher = &InWatcher;
+	Object = InArgs._Object;
+	Points.Reserve(FSubsystemWatchHistory::Capacity);
+}
+
+int32 SSubsystemSparkline::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const UObject* ObjectPtr = Object.Get();
+	if (!ObjectPtr)
+	{
+		return LayerId;
+	}
+
+	SB_TRACE_SCOPE(SSubsystemSparkline::OnPaint);
+
+	const FVector2D Size = AllottedGeometry.GetLocalSize();
+	const ESlateDrawEffect DrawEffect = ShouldBeEnabled(bParentEnabled) ? ESlateDrawEffect::None : ESlateDrawEffect::DisabledEffect;
+	const int32 NumColors = UE_ARRAY_COUNT(SubsystemSparkline::LineColors);
+
+	int32 LineIndex = 0;
+	Watcher->ForEachWatch(ObjectPtr, [&](const FSubsystemPropertyWatch& Watch)
+	{
+		const FSubsystemWatchHistory& History = Watch.History;
+		if (History.Num() < 2)
+			return;
+
+		float MinValue, MaxValue;
+		History.GetRange(MinValue, MaxValue);
+		const float Range = MaxValue - MinValue;
+
+		// history is always laid out against full capacity, so lines scroll from right to left
+		const float StepX = Size.X / (FSubsystemWatchHistory::Capacity - 1);
+		const float OffsetX = Size.X - StepX * (History.Num() - 1);
+
+		Points.Reset();
+		for (int32 Idx = 0; Idx < History.Num(); ++Idx)
+		{
+			const float Alpha = Range > KINDA_SMALL_NUMBER ? (History.Get(Idx) - MinValue) / Range : 0.5f;
+			Points.Emplace(OffsetX + StepX * Idx, (1.f - Alpha) * (Size.Y - 2.f) + 1.f);
+		}
+
+		const FLinearColor& Color = SubsystemSparkline::LineColors[LineIndex++ % NumColors];
+		FSlateDrawElement::MakeLines(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), Points, DrawEffect,
+			InWidgetStyle.GetColorAndOpacityTint() * Color, true, 1.f);
+	});
+
+	return LayerId;
+}
+
+FVector2D SSubsystemSparkline::ComputeDesiredSize(float) const
+{
+	return FVector2D(64.f, 16.f);
+}
@@ -0,0 +1,33 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class FSubsystemPropertyWatcher;
+
+/**
+ * Draws recent history of all watched properties of an object as overlaid sparklines.
+ * Each line is normalized to its own value range.
+ */
+class SSubsystemSparkline : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SSubsystemSparkline)
+		{}
+		/** Object which watched properties are drawn */
+		SLATE_ARGUMENT(TWeakObjectPtr<UObject>, Object)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, FSubsystemPropertyWatcher& InWatcher);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float) const override;
+
+private:
+	FSubsystemPropertyWatcher* Watcher = nullptr;
+	TWeakObjectPtr<UObject> Object;
+	/* reused between paints to avoid reallocations */
+	mutable TArray<FVector2D> Points;
+};
@@ -0,0 +1,166 @@
+// Copyright 2022, Aquanox.
+
+#include "UI/SubsystemTimelineFrameView.h"
+
+#include "Model/SubsystemBrowserTimeline.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SubsystemBrowser"
+
+namespace SubsystemTimelineFrameView
+{
+	static const FName ColumnName_Property = TEXT("Property");
+	static const FName ColumnName_Value = TEXT("Value");
+}
+
+/**
+ * Row of timeline frame view
+ */
+class SSubsystemTimelineFrameRow : public SMultiColumnTableRow<SubsystemTimelineFrameValuePtr>
+{
+	using Super = SMultiColumnTableRow<SubsystemTimelineFrameValuePtr>;
+public:
+	SLATE_BEGIN_ARGS(SSubsystemTimelineFrameRow)
+		{}
+		SLATE_ARGUMENT(SubsystemTimelineFrameValuePtr, Item)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+	{
+		Item = InArgs._Item;
+		Super::Construct(Super::FArguments(), InOwnerTableView);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+	{
+		if (ColumnName == SubsystemTimelineFrameView::ColumnName_Property)
+		{
+			return SNew(STextBlock)
+				.Text(FText::FromString(Item->Path));
+		}
+
+		// rows outlive scrub steps of same object, values are read on paint
+		return SNew(STextBlock)
+			.Text(this, &SSubsystemTimelineFrameRow::GetValueText)
+			.ToolTipText(this, &SSubsystemTimelineFrameRow::GetValueText);
+	}
+
+private:
+	FText GetValueText() const
+	{
+		return FText::FromString(Item->Value);
+	}
+
+	SubsystemTimelineFrameValuePtr Item;
+};
+
+void SSubsystemTimelineFrameView::Construct(const FArguments& InArgs)
+{
+	using namespace SubsystemTimelineFrameView;
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2)
+		[
+			SNew(STextBlock)
+			.Text(this, &SSubsystemTimelineFrameView::GetStatusText)
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SAssignNew(ListView, SListView<SubsystemTimelineFrameValuePtr>)
+			.ListItemsSource(&Items)
+			.SelectionMode(ESelectionMode::Single)
+			.OnGenerateRow(this, &SSubsystemTimelineFrameView::OnGenerateRow)
+			.HeaderRow
+			(
+				SNew(SHeaderRow)
+				+ SHeaderRow::Column(ColumnName_Property)
+				.DefaultLabel(LOCTEXT("TimelineFrameColumnProperty", "Property"))
+				.FillWidth(0.4f)
+				+ SHeaderRow::Column(ColumnName_Value)
+				.DefaultLabel(LOCTEXT("TimelineFrameColumnValue", "Value"))
+				.FillWidth(0.6f)
+			)
+		]
+	];
+}
+
+void SSubsystemTimelineFrameView::SetFrame(const FSubsystemTimelineObjectInfo& InObject, uint64 InFrame, const TArray<TOptional<FString>>& InValues)
+{
+	Frame = InFrame;
+
+	// same object keeps its rows, only values change between scrub steps
+	const bool bSameObject = ObjectName == InObject.Name && ClassPath == InObject.ClassPath && Items.Num() == InValues.Num();
+	if (!bSameObject)
+	{
+		ObjectName = InObject.Name;
+		ClassPath = InObject.ClassPath;
+
+		Items.Reset(InValues.Num());
+		for (int32 Idx = 0; Idx < InValues.Num(); ++Idx)
+		{
+			SubsystemTimelineFrameValuePtr Item = MakeShared<FSubsystemTimelineFrameValue>();
+			Item->Path = InObject.PropertyPaths.IsValidIndex(Idx) ? InObject.PropertyPaths[Idx] : FString();
+			Items.Add(Item);
+		}
+	}
+
+	NumRecorded = 0;
+	for (int32 Idx = 0; Idx < InValues.Num(); ++Idx)
+	{
+		if (InValues[Idx].IsSet())
+		{
+			Items[Idx]->Value = InValues[Idx].GetValue();
+			++NumRecorded;
+		}
+		else
+		{
+			Items[Idx]->Value.Reset();
+		}
+	}
+
+	if (!bSameObject && ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+void SSubsystemTimelineFrameView::ClearFrame()
+{
+	ObjectName.Reset();
+	ClassPath.Reset();
+	NumRecorded = 0;
+	Items.Reset();
+
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+FText SSubsystemTimelineFrameView::GetStatusText() const
+{
+	if (ObjectName.IsEmpty())
+	{
+		return LOCTEXT("TimelineFrameNoObject", "Selected object was not recorded in this timeline");
+	}
+
+	return FText::Format(LOCTEXT("TimelineFrameStatus", "{0} at frame {1}, {2} of {3} values recorded"),
+		FText::FromString(ObjectName), FText::AsNumber(Frame), FText::AsNumber(NumRecorded), FText::AsNumber(Items.Num()));
+}
+
+TSharedRef<ITableRow> SSubsystemTimelineFrameView::OnGenerateRow(SubsystemTimelineFrameValuePtr InItem, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SSubsystemTimelineFrameRow, OwnerTable)
+		.Item(InItem);
+}
+
+#undef LOCTEXT_NAMESPACE
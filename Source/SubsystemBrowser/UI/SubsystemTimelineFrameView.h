@@ -0,0 +1,56 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreFwd.h"
+#include "SlateFwd.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+struct FSubsystemTimelineObjectInfo;
+class ITableRow;
+
+/**
+ * Recorded value of a single property at displayed timeline frame
+ */
+struct FSubsystemTimelineFrameValue
+{
+	FString Path;
+	FString Value;
+};
+
+using SubsystemTimelineFrameValuePtr = TSharedPtr<FSubsystemTimelineFrameValue>;
+
+/**
+ * Read-only view of recorded property values of one object at a timeline frame.
+ *
+ * Values are displayed as recorded text, no object of recorded class is created for them.
+ * Rows are kept while the same object is scrubbed and only their values are updated.
+ */
+class SSubsystemTimelineFrameView : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SSubsystemTimelineFrameView)
+		{}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/* Display recorded values of object, values are indexed by object property table */
+	void SetFrame(const FSubsystemTimelineObjectInfo& InObject, uint64 InFrame, const TArray<TOptional<FString>>& InValues);
+	/* Display no values */
+	void ClearFrame();
+
+private:
+	FText GetStatusText() const;
+	TSharedRef<ITableRow> OnGenerateRow(SubsystemTimelineFrameValuePtr InItem, const TSharedRef<STableViewBase>& OwnerTable);
+
+private:
+	FString ObjectName;
+	FString ClassPath;
+	uint64 Frame = 0;
+	int32 NumRecorded = 0;
+
+	TArray<SubsystemTimelineFrameValuePtr> Items;
+	TSharedPtr<SListView<SubsystemTimelineFrameValuePtr>> ListView;
+};
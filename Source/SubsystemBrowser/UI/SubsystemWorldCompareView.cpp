@@ -0,0 +1,519 @@
+// Copyright 2022, Aquanox.
+
+#include "UI/SubsystemWorldCompareView.h"
+
+#include "SubsystemBrowserSettings.h"
+#include "SubsystemBrowserStyle.h"
+#include "SubsystemBrowserUtils.h"
+#include "Model/SubsystemBrowserModel.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Widgets/SWindow.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SExpanderArrow.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SubsystemBrowser"
+
+namespace SubsystemWorldCompareView
+{
+	static const FName ColumnName_Name = TEXT("Name");
+	static const FName ColumnName_World = TEXT("World");
+
+	/* seconds between two rehashes of compared values */
+	static constexpr float UpdateInterval = 0.5f;
+	/* maximum time per frame to spend rehashing compared values */
+	static constexpr double FrameBudget = 0.002;
+
+	static bool IsAllowedWorldType(EWorldType::Type InType)
+	{
+		if (USubsystemBrowserSettings::Get()->ShouldDisplayAllWorlds())
+			return true;
+		return InType == EWorldType::PIE || InType == EWorldType::Editor;
+	}
+}
+
+/**
+ * Row of world comparison tree
+ */
+class SSubsystemWorldCompareRow : public SMultiColumnTableRow<SubsystemWorldCompareItemPtr>
+{
+	using Super = SMultiColumnTableRow<SubsystemWorldCompareItemPtr>;
+public:
+	SLATE_BEGIN_ARGS(SSubsystemWorldCompareRow)
+		{}
+		SLATE_ARGUMENT(SubsystemWorldCompareItemPtr, Item)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+	{
+		Item = InArgs._Item;
+		Super::Construct(Super::FArguments(), InOwnerTableView);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+	{
+		using namespace SubsystemWorldCompareView;
+
+		if (ColumnName == ColumnName_Name)
+		{
+			const FText Name = Item->PropertyIndex == INDEX_NONE
+				? FText::Format(LOCTEXT("WorldCompareClassFormat", "{0} ({1})"), Item->Row->DisplayName, Item->Row->Category)
+				: FText::FromString(Item->Row->ClassInfo->Properties[Item->PropertyIndex].Path);
+
+			return SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				[
+					SNew(SExpanderArrow, SharedThis(this))
+				]
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.f)
+				.VAlign(VAlign_Center)
+				[
+					SNew(STextBlock)
+					.Text(Name)
+					.ColorAndOpacity(this, &SSubsystemWorldCompareRow::GetNameColor)
+				];
+		}
+
+		const int32 WorldIndex = ColumnName.GetNumber() - 1;
+		return SNew(SBorder)
+			.BorderImage(FStyleHelper::GetBrush("WhiteBrush"))
+			.BorderBackgroundColor(this, &SSubsystemWorldCompareRow::GetValueBackground, WorldIndex)
+			.Padding(FMargin(2, 0))
+			[
+				SNew(STextBlock)
+				.Text(this, &SSubsystemWorldCompareRow::GetValueText, WorldIndex)
+				.ToolTipText(this, &SSubsystemWorldCompareRow::GetValueText, WorldIndex)
+			];
+	}
+
+private:
+	FSlateColor GetNameColor() const
+	{
+		return Item->IsDifferent() ? USubsystemBrowserSettings::Get()->GetChangedColor() : FSlateColor::UseForeground();
+	}
+
+	FSlateColor GetValueBackground(int32 InWorldIndex) const
+	{
+		const FSubsystemWorldCompareRow& Row = *Item->Row;
+		const bool bHighlight = Item->PropertyIndex == INDEX_NONE
+			? Row.bMissingInstances && !Row.Instances[InWorldIndex].IsValid()
+			: Row.IsValueDifferent(InWorldIndex, Item->PropertyIndex);
+
+		if (!bHighlight)
+		{
+			return FSlateColor(FLinearColor::Transparent);
+		}
+
+		FLinearColor Color = USubsystemBrowserSettings::Get()->GetChangedColor().GetSpecifiedColor();
+		Color.A = 0.25f;
+		return FSlateColor(Color);
+	}
+
+	FText GetValueText(int32 InWorldIndex) const
+	{
+		return Item->Values.IsValidIndex(InWorldIndex) ? FText::FromString(Item->Values[InWorldIndex]) : FText::GetEmpty();
+	}
+
+	SubsystemWorldCompareItemPtr Item;
+};
+
+void SSubsystemWorldCompareView::Construct(const FArguments& InArgs)
+{
+	using namespace SubsystemWorldCompareView;
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SBorder)
+			.BorderImage(FStyleHelper::GetBrush(TEXT("ToolPanel.GroupBorder")))
+			[
+				SNew(SHorizontalBox)
+
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(2)
+				[
+					SNew(SComboButton)
+					.OnGetMenuContent(this, &SSubsystemWorldCompareView::GetWorldsMenuContent)
+					.ButtonContent()
+					[
+						SNew(STextBlock)
+						.Text(this, &SSubsystemWorldCompareView::GetWorldsButtonText)
+					]
+				]
+
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.f)
+				.Padding(2)
+				[
+					SNew(SSearchBox)
+					.HintText(LOCTEXT("WorldCompareFilterHint", "Search Subsystems or Properties"))
+					.OnTextChanged(this, &SSubsystemWorldCompareView::SetFilterText)
+				]
+
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(2)
+				[
+					SNew(SCheckBox)
+					.IsChecked(this, &SSubsystemWorldCompareView::GetOnlyDifferencesState)
+					.OnCheckStateChanged(this, &SSubsystemWorldCompareView::OnOnlyDifferencesChanged)
+					[
+						SNew(STextBlock).Text(LOCTEXT("WorldCompareOnlyDifferences", "Only Differences"))
+					]
+				]
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SAssignNew(TreeView, STreeView<SubsystemWorldCompareItemPtr>)
+			.TreeItemsSource(&RootItems)
+			.SelectionMode(ESelectionMode::Single)
+			.OnGenerateRow(this, &SSubsystemWorldCompareView::OnGenerateRow)
+			.OnGetChildren(this, &SSubsystemWorldCompareView::OnGetChildren)
+			.OnExpansionChanged_Lambda([this](SubsystemWorldCompareItemPtr InItem, bool bExpanded)
+			{
+				if (bExpanded)
+				{
+					for (const SubsystemWorldCompareItemPtr& Child : InItem->Children)
+					{
+						RefreshValues(*Child);
+					}
+				}
+			})
+			.HeaderRow
+			(
+				SAssignNew(HeaderRow, SHeaderRow)
+			)
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2)
+		[
+			SNew(STextBlock)
+			.Text(this, &SSubsystemWorldCompareView::GetStatusText)
+		]
+	];
+
+	// compare all play worlds by default, fall back to world displayed in browser
+	TArray<TWeakObjectPtr<UWorld>> InitialWorlds;
+	for (const FWorldContext& Context : GEngine->GetWorldContexts())
+	{
+		UWorld* World = Context.World();
+		if (World && World->WorldType == EWorldType::PIE)
+		{
+			InitialWorlds.Add(World);
+		}
+	}
+
+	if (!InitialWorlds.Num() && InArgs._InModel.IsValid() && InArgs._InModel->GetCurrentWorld().IsValid())
+	{
+		InitialWorlds.Add(InArgs._InModel->GetCurrentWorld());
+	}
+
+	SetWorlds(InitialWorlds);
+}
+
+void SSubsystemWorldCompareView::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// next pass is started once previous one has finished and interval has passed
+	if (!Comparison.IsUpdateInProgress())
+	{
+		TimeToUpdate -= InDeltaTime;
+		if (TimeToUpdate > 0.f)
+		{
+			return;
+		}
+
+		TimeToUpdate = SubsystemWorldCompareView::UpdateInterval;
+
+		if (Comparison.HasStaleWorlds())
+		{
+			TArray<TWeakObjectPtr<UWorld>> Worlds = Comparison.GetWorlds();
+			Worlds.RemoveAll([](const TWeakObjectPtr<UWorld>& World) { return !World.IsValid(); });
+			SetWorlds(Worlds);
+			return;
+		}
+
+		Comparison.BeginUpdate();
+	}
+
+	if (!Comparison.TickUpdate(SubsystemWorldCompareView::FrameBudget))
+	{
+		return;
+	}
+
+	RefreshVisibleValues();
+
+	if (bOnlyDifferences)
+	{
+		RebuildItems();
+	}
+	else
+	{
+		TreeView->RequestTreeRefresh();
+	}
+}
+
+void SSubsystemWorldCompareView::OpenWindow(TSharedPtr<FSubsystemModel> InModel)
+{
+	TSharedRef<SWindow> Window = SNew(SWindow)
+		.Title(LOCTEXT("WorldCompareWindowTitle", "Subsystem World Comparison"))
+		.ClientSize(FVector2D(1200, 600))
+		[
+			SNew(SSubsystemWorldCompareView)
+			.InModel(InModel)
+		];
+
+	FSlateApplication::Get().AddWindow(Window);
+}
+
+TSharedRef<SWidget> SSubsystemWorldCompareView::GetWorldsMenuContent()
+{
+	FMenuBuilder MenuBuilder(false, nullptr);
+
+	MenuBuilder.BeginSection("Worlds", LOCTEXT("WorldsHeading", "Worlds"));
+
+	for (const FWorldContext& Context : GEngine->GetWorldContexts())
+	{
+		UWorld* World = Context.World();
+		if (World && SubsystemWorldCompareView::IsAllowedWorldType(World->WorldType))
+		{
+			MenuBuilder.AddMenuEntry(
+				FSubsystemBrowserUtils::GetWorldDescription(World),
+				LOCTEXT("CompareWorldToolTip", "Include this world into comparison."),
+				FSlateIcon(),
+				FUIAction(
+					FExecuteAction::CreateSP(this, &SSubsystemWorldCompareView::ToggleWorld, MakeWeakObjectPtr(World)),
+					FCanExecuteAction(),
+					FIsActionChecked::CreateSP(this, &SSubsystemWorldCompareView::IsWorldCompared, MakeWeakObjectPtr(World))
+				),
+				NAME_None,
+				EUserInterfaceActionType::ToggleButton
+			);
+		}
+	}
+
+	MenuBuilder.EndSection();
+
+	return MenuBuilder.MakeWidget();
+}
+
+void SSubsystemWorldCompareView::ToggleWorld(TWeakObjectPtr<UWorld> InWorld)
+{
+	TArray<TWeakObjectPtr<UWorld>> Worlds = Comparison.GetWorlds();
+	if (Worlds.Remove(InWorld) == 0)
+	{
+		Worlds.Add(InWorld);
+	}
+	SetWorlds(Worlds);
+}
+
+bool SSubsystemWorldCompareView::IsWorldCompared(TWeakObjectPtr<UWorld> InWorld) const
+{
+	return Comparison.GetWorlds().Contains(InWorld);
+}
+
+FText SSubsystemWorldCompareView::GetWorldsButtonText() const
+{
+	return FText::Format(LOCTEXT("WorldCompareWorldsButton", "Worlds ({0})"), FText::AsNumber(Comparison.GetWorlds().Num()));
+}
+
+void SSubsystemWorldCompareView::SetWorlds(const TArray<TWeakObjectPtr<UWorld>>& InWorlds)
+{
+	Comparison.SetWorlds(InWorlds);
+	TimeToUpdate = SubsystemWorldCompareView::UpdateInterval;
+
+	RebuildColumns();
+
+	AllItems.Reset();
+	for (const TSharedRef<FSubsystemWorldCompareRow>& Row : Comparison.GetRows())
+	{
+		SubsystemWorldCompareItemPtr RowItem = MakeShared<FSubsystemWorldCompareItem>();
+		RowItem->Row = Row;
+		RefreshValues(*RowItem);
+
+		for (int32 PropertyIndex = 0; PropertyIndex < Row->GetNumProperties(); ++PropertyIndex)
+		{
+			SubsystemWorldCompareItemPtr PropertyItem = MakeShared<FSubsystemWorldCompareItem>();
+			PropertyItem->Row = Row;
+			PropertyItem->PropertyIndex = PropertyIndex;
+			RowItem->Children.Add(PropertyItem);
+		}
+
+		AllItems.Add(RowItem);
+	}
+
+	RebuildItems();
+}
+
+void SSubsystemWorldCompareView::RebuildColumns()
+{
+	using namespace SubsystemWorldCompareView;
+
+	const TArray<TWeakObjectPtr<UWorld>>& Worlds = Comparison.GetWorlds();
+
+	HeaderRow->ClearColumns();
+	HeaderRow->AddColumn(SHeaderRow::FColumn::FArguments()
+		.ColumnId(ColumnName_Name)
+		.DefaultLabel(LOCTEXT("WorldCompareColumnName", "Name"))
+		.FillWidth(0.3f));
+
+	for (int32 WorldIndex = 0; WorldIndex < Worlds.Num(); ++WorldIndex)
+	{
+		HeaderRow->AddColumn(SHeaderRow::FColumn::FArguments()
+			.ColumnId(FName(ColumnName_World, WorldIndex + 1))
+			.DefaultLabel(FSubsystemBrowserUtils::GetWorldDescription(Worlds[WorldIndex].Get()))
+			.FillWidth(0.7f / Worlds.Num()));
+	}
+}
+
+void SSubsystemWorldCompareView::RebuildItems()
+{
+	RootItems.Reset();
+	for (const SubsystemWorldCompareItemPtr& Item : AllItems)
+	{
+		if (PassesFilter(*Item))
+		{
+			RootItems.Add(Item);
+		}
+	}
+
+	TreeView->RequestTreeRefresh();
+}
+
+void SSubsystemWorldCompareView::RefreshVisibleValues()
+{
+	for (const SubsystemWorldCompareItemPtr& Item : RootItems)
+	{
+		RefreshValues(*Item);
+
+		if (TreeView->IsItemExpanded(Item))
+		{
+			for (const SubsystemWorldCompareItemPtr& Child : Item->Children)
+			{
+				RefreshValues(*Child);
+			}
+		}
+	}
+}
+
+void SSubsystemWorldCompareView::RefreshValues(FSubsystemWorldCompareItem& InItem) const
+{
+	const FSubsystemWorldCompareRow& Row = *InItem.Row;
+
+	InItem.Values.SetNum(Row.Instances.Num());
+	for (int32 WorldIndex = 0; WorldIndex < Row.Instances.Num(); ++WorldIndex)
+	{
+		if (InItem.PropertyIndex != INDEX_NONE)
+		{
+			Row.ExportValue(WorldIndex, InItem.PropertyIndex, InItem.Values[WorldIndex]);
+		}
+		else if (const UObject* Instance = Row.Instances[WorldIndex].Get())
+		{
+			InItem.Values[WorldIndex] = Row.NumDifferentProperties > 0
+				? FText::Format(LOCTEXT("WorldCompareInstanceDiffFormat", "{0} ({1} different)"), FText::FromString(Instance->GetName()), FText::AsNumber(Row.NumDifferentProperties)).ToString()
+				: Instance->GetName();
+		}
+		else
+		{
+			InItem.Values[WorldIndex] = LOCTEXT("WorldCompareMissing", "Missing").ToString();
+		}
+	}
+}
+
+void SSubsystemWorldCompareView::SetFilterText(const FText& InFilterText)
+{
+	FilterString = InFilterText.ToString().TrimStartAndEnd();
+	RebuildItems();
+}
+
+void SSubsystemWorldCompareView::OnOnlyDifferencesChanged(ECheckBoxState InState)
+{
+	bOnlyDifferences = InState == ECheckBoxState::Checked;
+	RebuildItems();
+}
+
+ECheckBoxState SSubsystemWorldCompareView::GetOnlyDifferencesState() const
+{
+	return bOnlyDifferences ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+bool SSubsystemWorldCompareView::PassesFilter(const FSubsystemWorldCompareItem& InItem) const
+{
+	if (bOnlyDifferences && !InItem.IsDifferent())
+	{
+		return false;
+	}
+
+	if (FilterString.IsEmpty())
+	{
+		return true;
+	}
+
+	const FSubsystemWorldCompareRow& Row = *InItem.Row;
+	if (Row.DisplayName.ToString().Contains(FilterString) || Row.Category.ToString().Contains(FilterString))
+	{
+		return true;
+	}
+
+	if (InItem.PropertyIndex != INDEX_NONE)
+	{
+		return Row.ClassInfo->Properties[InItem.PropertyIndex].Path.Contains(FilterString);
+	}
+
+	return InItem.Children.ContainsByPredicate([this](const SubsystemWorldCompareItemPtr& Child)
+	{
+		return PassesFilter(*Child);
+	});
+}
+
+FText SSubsystemWorldCompareView::GetStatusText() const
+{
+	if (Comparison.GetWorlds().Num() < 2)
+	{
+		return LOCTEXT("WorldCompareNotEnoughWorlds", "Select at least two worlds to compare");
+	}
+
+	return FText::Format(LOCTEXT("WorldCompareStatus", "{0} subsystems, {1} different"),
+		FText::AsNumber(Comparison.GetRows().Num()), FText::AsNumber(Comparison.GetNumDifferentRows()));
+}
+
+TSharedRef<ITableRow> SSubsystemWorldCompareView::OnGenerateRow(SubsystemWorldCompareItemPtr InItem, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SSubsystemWorldCompareRow, OwnerTable)
+		.Item(InItem);
+}
+
+void SSubsystemWorldCompareView::OnGetChildren(SubsystemWorldCompareItemPtr InItem, TArray<SubsystemWorldCompareItemPtr>& OutChildren)
+{
+	for (const SubsystemWorldCompareItemPtr& Child : InItem->Children)
+	{
+		if (PassesFilter(*Child))
+		{
+			OutChildren.Add(Child);
+		}
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
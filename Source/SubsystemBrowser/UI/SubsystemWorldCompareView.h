@@ -0,0 +1,86 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreFwd.h"
+#include "SlateFwd.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/STreeView.h"
+#include "Model/SubsystemBrowserWorldCompare.h"
+
+class FSubsystemModel;
+class ITableRow;
+class SHeaderRow;
+
+/**
+ * Row of world comparison tree, either subsystem class or one of its properties
+ */
+struct FSubsystemWorldCompareItem
+{
+	TSharedPtr<FSubsystemWorldCompareRow> Row;
+	/* index of property within row class info, INDEX_NONE for class rows */
+	int32 PropertyIndex = INDEX_NONE;
+	/* displayed value per world, refreshed only while visible */
+	TArray<FString> Values;
+
+	TArray<TSharedPtr<FSubsystemWorldCompareItem>> Children;
+
+	bool IsDifferent() const { return PropertyIndex == INDEX_NONE ? Row->IsDifferent() : Row->IsPropertyDifferent(PropertyIndex); }
+};
+
+using SubsystemWorldCompareItemPtr = TSharedPtr<FSubsystemWorldCompareItem>;
+
+/**
+ * Widget that displays state of same subsystems in several worlds side by side and highlights differences
+ */
+class SSubsystemWorldCompareView : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SSubsystemWorldCompareView)
+		{}
+		/** Model which current world is compared by default */
+		SLATE_ARGUMENT(TSharedPtr<FSubsystemModel>, InModel)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+	/* Open comparison view in a new window */
+	static void OpenWindow(TSharedPtr<FSubsystemModel> InModel);
+
+private:
+	TSharedRef<SWidget> GetWorldsMenuContent();
+	void ToggleWorld(TWeakObjectPtr<UWorld> InWorld);
+	bool IsWorldCompared(TWeakObjectPtr<UWorld> InWorld) const;
+	FText GetWorldsButtonText() const;
+	void SetWorlds(const TArray<TWeakObjectPtr<UWorld>>& InWorlds);
+
+	void RebuildColumns();
+	void RebuildItems();
+	void RefreshVisibleValues();
+	void RefreshValues(FSubsystemWorldCompareItem& InItem) const;
+
+	void SetFilterText(const FText& InFilterText);
+	void OnOnlyDifferencesChanged(ECheckBoxState InState);
+	ECheckBoxState GetOnlyDifferencesState() const;
+	bool PassesFilter(const FSubsystemWorldCompareItem& InItem) const;
+	FText GetStatusText() const;
+
+	TSharedRef<ITableRow> OnGenerateRow(SubsystemWorldCompareItemPtr InItem, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnGetChildren(SubsystemWorldCompareItemPtr InItem, TArray<SubsystemWorldCompareItemPtr>& OutChildren);
+
+private:
+	FSubsystemWorldComparison Comparison;
+
+	FString FilterString;
+	bool bOnlyDifferences = false;
+
+	/* time until next rehash of compared values */
+	float TimeToUpdate = 0.f;
+
+	TArray<SubsystemWorldCompareItemPtr> AllItems;
+	TArray<SubsystemWorldCompareItemPtr> RootItems;
+	TSharedPtr<SHeaderRow> HeaderRow;
+	TSharedPtr<STreeView<SubsystemWorldCompareItemPtr>> TreeView;
+};
@@ -0,0 +1,422 @@
+﻿// Copyright 2022, Aquanox.
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserStressCategory.h"
+#include "Model/SubsystemBrowserModel.h"
+#include "Model/SubsystemBrowserModelContext.h"
+#include "Model/SubsystemBrowserSnapshot.h"
+#include "Model/SubsystemBrowserSnapshotDiff.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#ifdef WITH_SB_TESTS
+
+namespace SubsystemBrowserModelTests
+{
+	static const FName ObjectCategoryName = TEXT("ModelTestObjects");
+	static const FName MetaCategoryName = TEXT("ModelTestMetaObjects");
+	static const FName EmptyCategoryName = TEXT("ModelTestEmpty");
+
+	static constexpr int32 NumObjects = 8;
+	static constexpr int32 NumMetaObjects = 4;
+	static constexpr int32 NumSubobjects = 3;
+
+	/**
+	 * In-memory settings, nothing is read from or written to config
+	 */
+	struct FFakeSettings : public ISubsystemModelSettings
+	{
+		bool bShowOnlyGame = false;
+		bool bShowOnlyPlugins = false;
+		bool bShowOnlyViewable = false;
+		bool bHideEmptyCategories = false;
+		bool bShowSubobjects = false;
+		TArray<FString> IgnoredSubsystems;
+		TMap<FName, bool> CategoryStates;
+
+		virtual bool ShouldShowOnlyGame() const override { return bShowOnlyGame; }
+		virtual bool ShouldShowOnlyPlugins() const override { return bShowOnlyPlugins; }
+		virtual bool ShouldShowOnlyViewable() const override { return bShowOnlyViewable; }
+		virtual bool ShouldHideEmptyCategories() const override { return bHideEmptyCategories; }
+		virtual bool ShouldShowSubobjects() const override { return bShowSubobjects; }
+		virtual bool HasIgnoredSubsystems() const override { return IgnoredSubsystems.Num() > 0; }
+		virtual bool IsSubsystemIgnored(const FString& InScriptName) const override { return IgnoredSubsystems.Contains(InScriptName); }
+		virtual bool GetTableColumnState(FName InColumn) const override { return false; }
+		virtual void LoadCategoryStates(TMap<FName, bool>& OutStates) override { OutStates = CategoryStates; }
+		virtual void SetCategoryState(FName InCategory, bool bInState) override { CategoryStates.Add(InCategory, bInState); }
+		virtual int32 GetMaxQuickActionsToShow() const override { return 10; }
+		virtual bool ShouldDisplayConfigExportActions() const override { return false; }
+		virtual void AddToIgnoreList(const FString& InClass, bool bMatchSubstring) override { IgnoredSubsystems.Add(InClass); }
+	};
+
+	/**
+	 * Provider with fixed set of stress categories, independent of module registry
+	 */
+	struct FFakeProvider : public ISubsystemModelProvider
+	{
+		TArray<SubsystemCategoryPtr> Categories;
+		TArray<SubsystemColumnPtr> DynamicColumns;
+
+		FFakeProvider()
+		{
+			FSubsystemStressParams Params;
+			Params.NumObjects = NumObjects;
+			Params.NumSubobjects = NumSubobjects;
+			Categories.Add(MakeShared<FSubsystemCategory_Stress>(ObjectCategoryName, Params));
+
+			Params.NumObjects = NumMetaObjects;
+			Params.bWithMetadata = true;
+			Categories.Add(MakeShared<FSubsystemCategory_Stress>(MetaCategoryName, Params));
+
+			Categories.Add(MakeShared<FSubsystemCategory_Stress>(EmptyCategoryName, FSubsystemStressParams()));
+		}
+
+		virtual const TArray<SubsystemCategoryPtr>& GetCategories() const override { return Categories; }
+		virtual const TArray<SubsystemColumnPtr>& GetDynamicColumns() const override { return DynamicColumns; }
+		virtual void GetPermanentColumns(TArray<SubsystemColumnPtr>& OutColumns) const override { FSubsystemBrowserModule::AddPermanentColumns(OutColumns); }
+	};
+
+	/* Build a model over fake providers, stress categories do not depend on world */
+	static TSharedRef<FSubsystemModel> CreateModel(const TSharedRef<FFakeSettings>& InSettings, const TSharedRef<FFakeProvider>& InProvider)
+	{
+		TSharedRef<FSubsystemModel> Model = MakeShared<FSubsystemModel>(InSettings, InProvider);
+		Model->SetCurrentWorld(nullptr);
+		return Model;
+	}
+
+	static int32 CountFiltered(FSubsystemModel& InModel, FName InCategory)
+	{
+		for (const SubsystemTreeItemPtr& Category : InModel.GetAllCategories())
+		{
+			if (Category->GetID() == InCategory)
+			{
+				return InModel.GetNumSubsystemsFromCategory(Category);
+			}
+		}
+		return INDEX_NONE;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubsystemModelFilterTest, "SubsystemBrowser.Model.Filter",
+	EAutomationTestFlags::EditorContext |
+	EAutomationTestFlags::ProductFilter);
+
+bool FSubsystemModelFilterTest::RunTest(const FString& Parameters)
+{
+	using namespace SubsystemBrowserModelTests;
+
+	TSharedRef<FFakeSettings> Settings = MakeShared<FFakeSettings>();
+	TSharedRef<FFakeProvider> Provider = MakeShared<FFakeProvider>();
+	TSharedRef<FSubsystemModel> Model = CreateModel(Settings, Provider);
+
+	TestEqual(TEXT("NumCategories"), Model->GetNumCategories(), 3);
+	TestEqual(TEXT("NumSubsystems"), Model->GetAllSubsystems().Num(), NumObjects + NumMetaObjects);
+
+	for (const SubsystemTreeItemPtr& Item : Model->GetAllSubsystems())
+	{
+		TestFalse(TEXT("IsGameModule"), Item->IsGameModule());
+		TestTrue(TEXT("IsPluginModule"), Item->IsPluginModule());
+		TestTrue(TEXT("HasViewableElements"), Item->HasViewableElements());
+	}
+
+	const FString MetaScriptName = FString::Printf(TEXT("/Script/SubsystemBrowserTests.%s"), *USBStressMetaObject::StaticClass()->GetName());
+
+	// walk every combination of filter flags and compare against expected visibility
+	constexpr int32 NumFlags = 5;
+	for (int32 Mask = 0; Mask < (1 << NumFlags); ++Mask)
+	{
+		Settings->bShowOnlyGame = !!(Mask & 1);
+		Settings->bShowOnlyPlugins = !!(Mask & 2);
+		Settings->bShowOnlyViewable = !!(Mask & 4);
+		Settings->bHideEmptyCategories = !!(Mask & 8);
+		Settings->IgnoredSubsystems.Reset();
+		if (Mask & 16)
+		{
+			Settings->IgnoredSubsystems.Add(MetaScriptName);
+		}
+
+		const int32 ExpectedObjects = Settings->bShowOnlyGame ? 0 : NumObjects;
+		const int32 ExpectedMeta = (Settings->bShowOnlyGame || Settings->HasIgnoredSubsystems()) ? 0 : NumMetaObjects;
+		const int32 ExpectedCategories = Settings->bHideEmptyCategories ? (ExpectedObjects > 0) + (ExpectedMeta > 0) : 3;
+
+		const FString Context = FString::Printf(TEXT("Mask %d"), Mask);
+
+		TestEqual(Context + TEXT(" IsSubsystemFilterActive"), Model->IsSubsystemFilterActive(), (Mask & ~8) != 0);
+		TestEqual(Context + TEXT(" Objects"), CountFiltered(*Model, ObjectCategoryName), ExpectedObjects);
+		TestEqual(Context + TEXT(" MetaObjects"), CountFiltered(*Model, MetaCategoryName), ExpectedMeta);
+		TestEqual(Context + TEXT(" Empty"), CountFiltered(*Model, EmptyCategoryName), 0);
+
+		TArray<SubsystemTreeItemPtr> Categories;
+		Model->GetFilteredCategories(Categories);
+		TestEqual(Context + TEXT(" Categories"), Categories.Num(), ExpectedCategories);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubsystemModelCategoryFilterTest, "SubsystemBrowser.Model.CategoryFilter",
+	EAutomationTestFlags::EditorContext |
+	EAutomationTestFlags::ProductFilter);
+
+bool FSubsystemModelCategoryFilterTest::RunTest(const FString& Parameters)
+{
+	using namespace SubsystemBrowserModelTests;
+
+	TSharedRef<FFakeSettings> Settings = MakeShared<FFakeSettings>();
+	TSharedRef<FSubsystemModel> Model = CreateModel(Settings, MakeShared<FFakeProvider>());
+
+	TSharedRef<SubsystemCategoryFilter> Filter = MakeShared<SubsystemCategoryFilter>(Settings);
+	Model->CategoryFilter = Filter;
+
+	Filter->HideCategory(MetaCategoryName);
+
+	TArray<SubsystemTreeItemPtr> Categories;
+	Model->GetFilteredCategories(Categories);
+	TestEqual(TEXT("Categories"), Categories.Num(), 2);
+	TestFalse(TEXT("MetaCategoryVisible"), Filter->IsCategoryVisible(MetaCategoryName));
+	TestTrue(TEXT("StateStored"), Settings->CategoryStates.Contains(MetaCategoryName));
+	TestEqual(TEXT("SubsystemsInVisible"), Model->GetNumSubsystemsFromVisibleCategories(), NumObjects);
+
+	// new filter picks up state from settings
+	SubsystemCategoryFilter RestoredFilter(Settings);
+	TestFalse(TEXT("RestoredMetaCategoryVisible"), RestoredFilter.IsCategoryVisible(MetaCategoryName));
+	TestTrue(TEXT("RestoredObjectCategoryVisible"), RestoredFilter.IsCategoryVisible(ObjectCategoryName));
+
+	Filter->ShowCategory(MetaCategoryName);
+	Model->GetFilteredCategories(Categories);
+	TestEqual(TEXT("CategoriesAfterShow"), Categories.Num(), 3);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubsystemModelTextFilterTest, "SubsystemBrowser.Model.TextFilter",
+	EAutomationTestFlags::EditorContext |
+	EAutomationTestFlags::ProductFilter);
+
+bool FSubsystemModelTextFilterTest::RunTest(const FString& Parameters)
+{
+	using namespace SubsystemBrowserModelTests;
+
+	TSharedRef<FSubsystemModel> Model = CreateModel(MakeShared<FFakeSettings>(), MakeShared<FFakeProvider>());
+
+	TSharedRef<SubsystemTextFilter> TextFilter = MakeShared<SubsystemTextFilter>(
+		SubsystemTextFilter::FItemToStringArray::CreateLambda([&Model](const ISubsystemTreeItem& Item, TArray<FString>& OutSearchStrings)
+		{
+			for (const SubsystemColumnPtr& Column : Model->GetSelectedTableColumns())
+			{
+				Column->PopulateSearchStrings(Item, OutSearchStrings);
+			}
+		})
+	);
+	Model->SubsystemTextFilter = TextFilter;
+
+	TextFilter->SetRawFilterText(USBStressMetaObject::StaticClass()->GetDisplayNameText());
+	TestTrue(TEXT("IsSubsystemFilterActive"), Model->IsSubsystemFilterActive());
+	TestEqual(TEXT("Objects"), CountFiltered(*Model, ObjectCategoryName), 0);
+	TestEqual(TEXT("MetaObjects"), CountFiltered(*Model, MetaCategoryName), NumMetaObjects);
+
+	TextFilter->SetRawFilterText(FText::GetEmpty());
+	TestFalse(TEXT("IsSubsystemFilterActiveCleared"), Model->IsSubsystemFilterActive());
+	TestEqual(TEXT("ObjectsCleared"), CountFiltered(*Model, ObjectCategoryName), NumObjects);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubsystemModelSubobjectsTest, "SubsystemBrowser.Model.Subobjects",
+	EAutomationTestFlags::EditorContext |
+	EAutomationTestFlags::ProductFilter);
+
+bool FSubsystemModelSubobjectsTest::RunTest(const FString& Parameters)
+{
+	using namespace SubsystemBrowserModelTests;
+
+	TSharedRef<FFakeSettings> Settings = MakeShared<FFakeSettings>();
+	TSharedRef<FSubsystemModel> Model = CreateModel(Settings, MakeShared<FFakeProvider>());
+
+	TArray<SubsystemTreeItemPtr> Children;
+	for (const SubsystemTreeItemPtr& Item : Model->GetAllSubsystems())
+	{
+		Settings->bShowSubobjects = false;
+		Model->GetSubsystemSubobjects(Item, Children);
+		TestEqual(TEXT("Hidden"), Children.Num(), 0);
+		TestFalse(TEXT("CanHaveChildrenHidden"), Item->CanHaveChildren());
+
+		Settings->bShowSubobjects = true;
+		Model->GetSubsystemSubobjects(Item, Children);
+		TestEqual(TEXT("Shown"), Children.Num(), NumSubobjects);
+		TestTrue(TEXT("CanHaveChildrenShown"), Item->CanHaveChildren());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubsystemModelSortTest, "SubsystemBrowser.Model.Sort",
+	EAutomationTestFlags::EditorContext |
+	EAutomationTestFlags::ProductFilter);
+
+bool FSubsystemModelSortTest::RunTest(const FString& Parameters)
+{
+	using namespace SubsystemBrowserModelTests;
+
+	TSharedRef<FSubsystemModel> Model = CreateModel(MakeShared<FFakeSettings>(), MakeShared<FFakeProvider>());
+
+	SubsystemColumnPtr NameColumn = Model->FindTableColumn(TEXT("Name"));
+	if (!TestTrue(TEXT("NameColumn"), NameColumn.IsValid()))
+	{
+		return false;
+	}
+
+	TArray<SubsystemTreeItemPtr> Items = Model->GetAllSubsystems();
+
+	NameColumn->SortItems(Items, EColumnSortMode::Descending);
+	for (int32 Idx = 1; Idx < Items.Num(); ++Idx)
+	{
+		TestTrue(TEXT("Descending"), Items[Idx - 1]->GetDisplayName().ToString() >= Items[Idx]->GetDisplayName().ToString());
+	}
+
+	NameColumn->SortItems(Items, EColumnSortMode::Ascending);
+	for (int32 Idx = 1; Idx < Items.Num(); ++Idx)
+	{
+		TestTrue(TEXT("Ascending"), Items[Idx - 1]->GetDisplayName().ToString() <= Items[Idx]->GetDisplayName().ToString());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubsystemSnapshotRoundTripTest, "SubsystemBrowser.Model.SnapshotRoundTrip",
+	EAutomationTestFlags::EditorContext |
+	EAutomationTestFlags::ProductFilter);
+
+bool FSubsystemSnapshotRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace SubsystemBrowserModelTests;
+
+	TSharedRef<FSubsystemModel> Model = CreateModel(MakeShared<FFakeSettings>(), MakeShared<FFakeProvider>());
+	TSharedRef<FSubsystemSnapshot> Snapshot = FSubsystemSnapshot::Capture(*Model, true);
+	TestEqual(TEXT("NumObjects"), Snapshot->Objects.Num(), NumObjects * (1 + NumSubobjects) + NumMetaObjects);
+
+	const FString FilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("SubsystemBrowser"), TEXT("RoundTrip.sbsnap"));
+	if (!TestTrue(TEXT("Saved"), Snapshot->SaveToFile(FilePath)))
+	{
+		return false;
+	}
+
+	TSharedPtr<FSubsystemSnapshot> Loaded = FSubsystemSnapshot::LoadFromFile(FilePath);
+	IFileManager::Get().Delete(*FilePath);
+	if (!TestTrue(TEXT("Loaded"), Loaded.IsValid()))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("WorldName"), Loaded->WorldName, Snapshot->WorldName);
+	TestEqual(TEXT("Timestamp"), Loaded->Timestamp, Snapshot->Timestamp);
+	TestTrue(TEXT("Strings"), Loaded->Strings == Snapshot->Strings);
+	if (!TestEqual(TEXT("LoadedObjects"), Loaded->Objects.Num(), Snapshot->Objects.Num()))
+	{
+		return false;
+	}
+
+	for (int32 Idx = 0; Idx < Snapshot->Objects.Num(); ++Idx)
+	{
+		const FSubsystemSnapshotObject& Expected = Snapshot->Objects[Idx];
+		const FSubsystemSnapshotObject& Actual = Loaded->Objects[Idx];
+		TestEqual(TEXT("CategoryIndex"), Actual.CategoryIndex, Expected.CategoryIndex);
+		TestEqual(TEXT("ClassIndex"), Actual.ClassIndex, Expected.ClassIndex);
+		TestEqual(TEXT("NameIndex"), Actual.NameIndex, Expected.NameIndex);
+		TestEqual(TEXT("ParentIndex"), Actual.ParentIndex, Expected.ParentIndex);
+		TestEqual(TEXT("ObjectHash"), Actual.Hash, Expected.Hash);
+
+		if (!TestEqual(TEXT("NumProperties"), Actual.Properties.Num(), Expected.Properties.Num()))
+			continue;
+
+		for (int32 PropIdx = 0; PropIdx < Expected.Properties.Num(); ++PropIdx)
+		{
+			TestEqual(TEXT("PathIndex"), Actual.Properties[PropIdx].PathIndex, Expected.Properties[PropIdx].PathIndex);
+			TestEqual(TEXT("ValueIndex"), Actual.Properties[PropIdx].ValueIndex, Expected.Properties[PropIdx].ValueIndex);
+			TestEqual(TEXT("PropertyHash"), Actual.Properties[PropIdx].Hash, Expected.Properties[PropIdx].Hash);
+		}
+	}
+
+	// identical snapshots produce no differences
+	const FSubsystemSnapshotDiff Diff = FSubsystemSnapshotDiff::Compute(*Snapshot, *Loaded);
+	TestEqual(TEXT("NoChanges"), Diff.Objects.Num(), 0);
+	TestEqual(TEXT("AllUnchanged"), Diff.NumUnchanged, Snapshot->Objects.Num());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubsystemSnapshotDiffTest, "SubsystemBrowser.Model.SnapshotDiff",
+	EAutomationTestFlags::EditorContext |
+	EAutomationTestFlags::ProductFilter);
+
+bool FSubsystemSnapshotDiffTest::RunTest(const FString& Parameters)
+{
+	using namespace SubsystemBrowserModelTests;
+
+	static const FName AddedCategoryName = TEXT("ModelTestAdded");
+	static constexpr int32 NumAddedObjects = 2;
+
+	TSharedRef<FFakeProvider> BaseProvider = MakeShared<FFakeProvider>();
+	TSharedRef<FSubsystemModel> BaseModel = CreateModel(MakeShared<FFakeSettings>(), BaseProvider);
+	TSharedRef<FSubsystemSnapshot> Base = FSubsystemSnapshot::Capture(*BaseModel, false);
+
+	// target keeps object category, drops meta category and introduces a new one
+	FSubsystemStressParams AddedParams;
+	AddedParams.NumObjects = NumAddedObjects;
+
+	TSharedRef<FFakeProvider> TargetProvider = MakeShared<FFakeProvider>();
+	TargetProvider->Categories.Reset();
+	TargetProvider->Categories.Add(BaseProvider->Categories[0]);
+	TargetProvider->Categories.Add(MakeShared<FSubsystemCategory_Stress>(AddedCategoryName, AddedParams));
+
+	const TSharedPtr<FSubsystemCategory_Stress> ObjectCategory = StaticCastSharedPtr<FSubsystemCategory_Stress>(BaseProvider->Categories[0]);
+	USBStressObject* const ModifiedObject = ObjectCategory->GetObjects()[0].Get();
+	ModifiedObject->ConfigIntProperty = -1;
+
+	TSharedRef<FSubsystemModel> TargetModel = CreateModel(MakeShared<FFakeSettings>(), TargetProvider);
+	TSharedRef<FSubsystemSnapshot> Target = FSubsystemSnapshot::Capture(*TargetModel, false);
+
+	const FSubsystemSnapshotDiff Diff = FSubsystemSnapshotDiff::Compute(*Base, *Target);
+
+	int32 NumAdded = 0;
+	int32 NumRemoved = 0;
+	int32 NumModified = 0;
+	for (const FSubsystemSnapshotObjectDiff& Object : Diff.Objects)
+	{
+		switch (Object.Change)
+		{
+		case ESubsystemSnapshotChange::Added:
+			++NumAdded;
+			TestEqual(TEXT("AddedCategory"), Object.Category, AddedCategoryName.ToString());
+			TestEqual(TEXT("AddedProperties"), Object.Properties.Num(), 0);
+			break;
+		case ESubsystemSnapshotChange::Removed:
+			++NumRemoved;
+			TestEqual(TEXT("RemovedCategory"), Object.Category, MetaCategoryName.ToString());
+			TestEqual(TEXT("RemovedProperties"), Object.Properties.Num(), 0);
+			break;
+		case ESubsystemSnapshotChange::Modified:
+			++NumModified;
+			TestEqual(TEXT("ModifiedName"), Object.Name, ModifiedObject->GetName());
+			if (TestEqual(TEXT("ModifiedProperties"), Object.Properties.Num(), 1))
+			{
+				const FSubsystemSnapshotPropertyDiff& Property = Object.Properties[0];
+				TestEqual(TEXT("ModifiedPath"), Property.Path, FString(TEXT("ConfigIntProperty")));
+				TestEqual(TEXT("ModifiedBaseValue"), Property.BaseValue, FString(TEXT("0")));
+				TestEqual(TEXT("ModifiedTargetValue"), Property.TargetValue, FString(TEXT("-1")));
+				TestTrue(TEXT("ModifiedChange"), Property.Change == ESubsystemSnapshotChange::Modified);
+			}
+			break;
+		}
+	}
+
+	TestEqual(TEXT("NumAdded"), NumAdded, NumAddedObjects);
+	TestEqual(TEXT("NumRemoved"), NumRemoved, NumMetaObjects);
+	TestEqual(TEXT("NumModified"), NumModified, 1);
+	TestEqual(TEXT("NumUnchanged"), Diff.NumUnchanged, NumObjects - 1);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,258 @@
+﻿// Copyright 2022, Aquanox.
+
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserSettings.h"
+#include "SubsystemBrowserUtils.h"
+#include "SubsystemBrowserStressCategory.h"
+#include "Model/SubsystemBrowserModel.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectArray.h"
+
+#ifdef WITH_SB_TESTS
+
+namespace SubsystemBrowserPerf
+{
+	static const FName CategoryName = TEXT("PerfSynthetic");
+
+	/* Number of timed runs for each measured operation */
+	static constexpr int32 NumIterations = 10;
+
+	/* Configurations in form of NumObjects x NumSubobjects */
+	static const TCHAR* const Configurations[] = {
+		TEXT("100x0"),
+		TEXT("1000x4"),
+		TEXT("5000x8")
+	};
+
+	/**
+	 * Timing and allocation results of a single measured operation
+	 */
+	struct FMeasurement
+	{
+		FString Name;
+		TArray<double> Samples;
+		/* change of used physical memory over all runs */
+		int64 MemoryDelta = 0;
+		/* change of live UObject count over all runs */
+		int32 ObjectDelta = 0;
+
+		/* nearest-rank percentile of samples, in milliseconds */
+		double GetPercentileMs(float InPercentile) const
+		{
+			if (!Samples.Num())
+				return 0.0;
+
+			TArray<double> Sorted = Samples;
+			Sorted.Sort();
+
+			const int32 Index = FMath::Clamp(FMath::CeilToInt(InPercentile * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+			return Sorted[Index] * 1000.0;
+		}
+	};
+
+	template<typename TFunc>
+	FMeasurement Measure(const TCHAR* InName, TFunc&& InFunc)
+	{
+		FMeasurement Result;
+		Result.Name = InName;
+		Result.Samples.Reserve(NumIterations);
+
+		const uint64 StartMemory = FPlatformMemory::GetStats().UsedPhysical;
+		const int32 StartObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			InFunc(Iteration);
+			Result.Samples.Add(FPlatformTime::Seconds() - StartTime);
+		}
+
+		Result.MemoryDelta = (int64)FPlatformMemory::GetStats().UsedPhysical - (int64)StartMemory;
+		Result.ObjectDelta = GUObjectArray.GetObjectArrayNumMinusAvailable() - StartObjects;
+		return Result;
+	}
+
+	/* Walk visible categories and their subsystems the way browser panel does */
+	int32 GatherFiltered(FSubsystemModel& InModel)
+	{
+		int32 NumVisible = 0;
+
+		TArray<SubsystemTreeItemPtr> Categories;
+		InModel.GetFilteredCategories(Categories);
+
+		TArray<SubsystemTreeItemPtr> Subsystems;
+		for (const SubsystemTreeItemPtr& Category : Categories)
+		{
+			InModel.GetFilteredSubsystems(Category, Subsystems);
+			NumVisible += Subsystems.Num();
+		}
+		return NumVisible;
+	}
+
+	/* Append results to csv report within Saved folder */
+	FString WriteReport(const FString& InConfiguration, const TArray<FMeasurement>& InResults)
+	{
+		const FString ReportPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SubsystemBrowser"), TEXT("Perf"), TEXT("ModelPerf.csv"));
+
+		FString Report;
+		if (!IFileManager::Get().FileExists(*ReportPath))
+		{
+			Report += TEXT("Timestamp,Configuration,Metric,Iterations,MedianMs,P95Ms,MemoryDeltaKb,ObjectDelta");
+			Report += LINE_TERMINATOR;
+		}
+
+		const FString Timestamp = FDateTime::UtcNow().ToIso8601();
+		for (const FMeasurement& Result : InResults)
+		{
+			Report += FString::Printf(TEXT("%s,%s,%s,%d,%.4f,%.4f,%.1f,%d%s"),
+				*Timestamp, *InConfiguration, *Result.Name, Result.Samples.Num(),
+				Result.GetPercentileMs(0.5f), Result.GetPercentileMs(0.95f),
+				Result.MemoryDelta / 1024.0, Result.ObjectDelta, LINE_TERMINATOR);
+		}
+
+		FFileHelper::SaveStringToFile(Report, *ReportPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+		return ReportPath;
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FSubsystemModelPerfTest, "SubsystemBrowser.Perf.Model",
+	EAutomationTestFlags::EditorContext |
+	EAutomationTestFlags::PerfFilter);
+
+void FSubsystemModelPerfTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const TCHAR* Configuration : SubsystemBrowserPerf::Configurations)
+	{
+		OutBeautifiedNames.Add(Configuration);
+		OutTestCommands.Add(Configuration);
+	}
+}
+
+bool FSubsystemModelPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace SubsystemBrowserPerf;
+
+	FString NumObjectsString, NumSubobjectsString;
+	if (!Parameters.Split(TEXT("x"), &NumObjectsString, &NumSubobjectsString))
+	{
+		AddError(FString::Printf(TEXT("Invalid configuration %s"), *Parameters));
+		return false;
+	}
+
+	FSubsystemBrowserModule& BrowserModule = FSubsystemBrowserModule::Get();
+	FSubsystemStressParams Params;
+	Params.NumObjects = FCString::Atoi(*NumObjectsString);
+	Params.NumSubobjects = FCString::Atoi(*NumSubobjectsString);
+	Params.PayloadSize = 4;
+
+	TSharedRef<FSubsystemCategory_Stress> Category = MakeShared<FSubsystemCategory_Stress>(CategoryName, Params);
+	BrowserModule.RegisterCategory(Category);
+	ON_SCOPE_EXIT
+	{
+		BrowserModule.RemoveCategory(CategoryName);
+	};
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Inactive, false, TEXT("SubsystemBrowserPerfWorld"));
+	ON_SCOPE_EXIT
+	{
+		World->DestroyWorld(false);
+	};
+
+	TSharedRef<FSubsystemModel> Model = MakeShared<FSubsystemModel>();
+
+	TArray<FMeasurement> Results;
+
+	Results.Add(Measure(TEXT("SetCurrentWorld"), [&](int32)
+	{
+		Model->SetCurrentWorld(World);
+	}));
+
+	int32 NumFiltered = 0;
+	Results.Add(Measure(TEXT("GetFiltered"), [&](int32)
+	{
+		NumFiltered = GatherFiltered(*Model);
+	}));
+
+	TSharedRef<SubsystemTextFilter> TextFilter = MakeShared<SubsystemTextFilter>(
+		SubsystemTextFilter::FItemToStringArray::CreateLambda([&Model](const ISubsystemTreeItem& Item, TArray<FString>& OutSearchStrings)
+		{
+			if (Item.GetAsSubsystemDescriptor())
+			{
+				for (const SubsystemColumnPtr& Column : Model->GetSelectedTableColumns())
+				{
+					Column->PopulateSearchStrings(Item, OutSearchStrings);
+				}
+			}
+		})
+	);
+	TextFilter->SetRawFilterText(FText::FromString(TEXT("Stress")));
+	Model->SubsystemTextFilter = TextFilter;
+
+	Results.Add(Measure(TEXT("TextFilter"), [&](int32)
+	{
+		GatherFiltered(*Model);
+	}));
+
+	Model->SubsystemTextFilter.Reset();
+
+	TArray<SubsystemTreeItemPtr> SyntheticItems;
+	for (const SubsystemTreeItemPtr& CategoryItem : Model->GetAllCategories())
+	{
+		if (CategoryItem->GetID() == CategoryName)
+		{
+			Model->GetAllSubsystemsInCategory(CategoryItem, SyntheticItems);
+		}
+	}
+
+	if (USubsystemBrowserSettings::Get()->ShouldShowSubobjbects())
+	{
+		Results.Add(Measure(TEXT("GetSubsystemSubobjects"), [&](int32)
+		{
+			TArray<SubsystemTreeItemPtr> Children;
+			for (const SubsystemTreeItemPtr& Item : SyntheticItems)
+			{
+				Model->GetSubsystemSubobjects(Item, Children);
+			}
+		}));
+	}
+
+	if (SubsystemColumnPtr NameColumn = Model->FindTableColumn(TEXT("Name")))
+	{
+		// alternate sort direction so each run starts from reversed order
+		TArray<SubsystemTreeItemPtr> SortedItems = Model->GetAllSubsystems();
+		Results.Add(Measure(TEXT("SortItems"), [&](int32 Iteration)
+		{
+			NameColumn->SortItems(SortedItems, Iteration % 2 ? EColumnSortMode::Descending : EColumnSortMode::Ascending);
+		}));
+	}
+
+	Results.Add(Measure(TEXT("GenerateConfigExport"), [&](int32)
+	{
+		for (const TStrongObjectPtr<USBStressObject>& Object : Category->GetObjects())
+		{
+			FSubsystemBrowserUtils::GenerateConfigExport(Object.Get(), false);
+		}
+	}));
+
+	TestEqual(TEXT("SyntheticItems"), SyntheticItems.Num(), Params.NumObjects);
+	AddInfo(FString::Printf(TEXT("%d subsystems visible with current browser settings"), NumFiltered));
+
+	for (const FMeasurement& Result : Results)
+	{
+		AddInfo(FString::Printf(TEXT("%s: median %.3f ms, p95 %.3f ms, memory %+.1f Kb, objects %+d"),
+			*Result.Name, Result.GetPercentileMs(0.5f), Result.GetPercentileMs(0.95f), Result.MemoryDelta / 1024.0, Result.ObjectDelta));
+	}
+
+	const FString ReportPath = WriteReport(Parameters, Results);
+	AddInfo(FString::Printf(TEXT("Report written to %s"), *ReportPath));
+
+	return true;
+}
+
+#endif
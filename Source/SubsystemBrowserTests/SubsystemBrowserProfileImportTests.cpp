@@ -0,0 +1,128 @@
+﻿// Copyright 2022, Aquanox.
+
+#include "Model/SubsystemBrowserProfileImport.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#ifdef WITH_SB_TESTS
+
+namespace SubsystemBrowserProfileImportTests
+{
+	static const FName ClassName = TEXT("SBProfiledSubsystem");
+
+	/* Tolerance for summed times, values are parsed from text */
+	static constexpr double Tolerance = 1e-6;
+
+	/* Write CSV into transient directory and import it synchronously */
+	static bool Import(const FString& InName, const FString& InContent, TMap<FName, FSubsystemProfileTiming>& OutResults, bool& bOutHasCallCounts)
+	{
+		TMap<FString, FName> ClassNames;
+		ClassNames.Add(ClassName.ToString(), ClassName);
+		ClassNames.Add(TEXT("U") + ClassName.ToString(), ClassName);
+
+		const FString FilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("SubsystemBrowser"), InName + TEXT(".csv"));
+		if (!FFileHelper::SaveStringToFile(InContent, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			return false;
+		}
+
+		const bool bResult = FSubsystemProfileImport::ImportFile(FilePath, ClassNames, OutResults, bOutHasCallCounts);
+		IFileManager::Get().Delete(*FilePath);
+		return bResult;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubsystemProfileImportCsvTest, "SubsystemBrowser.ProfileImport.Csv",
+	EAutomationTestFlags::EditorContext |
+	EAutomationTestFlags::ProductFilter);
+
+bool FSubsystemProfileImportCsvTest::RunTest(const FString& Parameters)
+{
+	using namespace SubsystemBrowserProfileImportTests;
+
+	TMap<FName, FSubsystemProfileTiming> Results;
+	bool bHasCallCounts = false;
+
+	// csvprofile: column per stat in milliseconds, exclusive columns and frames without time are skipped
+	if (TestTrue(TEXT("FrameImported"), Import(TEXT("Frames"),
+		TEXT("FrameTime,USBProfiledSubsystem::Tick,Exclusive/USBProfiledSubsystem::Tick\r\n")
+		TEXT("16.6,1.5,0.5\r\n")
+		TEXT("16.6,0,0\r\n")
+		TEXT("FrameTime,USBProfiledSubsystem::Tick,Exclusive/USBProfiledSubsystem::Tick\r\n")
+		TEXT("16.6,2.5,1\r\n")
+		TEXT("[HasHeaderRowAtEnd],1\r\n"), Results, bHasCallCounts)))
+	{
+		TestFalse(TEXT("FrameHasCallCounts"), bHasCallCounts);
+		const FSubsystemProfileTiming* Timing = Results.Find(ClassName);
+		if (TestNotNull(TEXT("FrameTiming"), Timing))
+		{
+			TestEqual(TEXT("FrameTotalMs"), Timing->TotalMs, 4.0, Tolerance);
+			TestEqual(TEXT("FrameCalls"), Timing->Calls, (int64)2);
+		}
+	}
+
+	// timer aggregates: unit in header overrides default milliseconds of Incl column
+	if (TestTrue(TEXT("TimerImported"), Import(TEXT("Timers"),
+		TEXT("Name,Count,Incl (s)\n")
+		TEXT("SBProfiledSubsystem,3,0.002\n")
+		TEXT("OtherScope,10,1.0\n"), Results, bHasCallCounts)))
+	{
+		TestTrue(TEXT("TimerHasCallCounts"), bHasCallCounts);
+		TestEqual(TEXT("TimerNumMatched"), Results.Num(), 1);
+		const FSubsystemProfileTiming* Timing = Results.Find(ClassName);
+		if (TestNotNull(TEXT("TimerTiming"), Timing))
+		{
+			TestEqual(TEXT("TimerTotalMs"), Timing->TotalMs, 2.0, Tolerance);
+			TestEqual(TEXT("TimerCalls"), Timing->Calls, (int64)3);
+		}
+	}
+
+	// unit written after value overrides unit of column
+	if (TestTrue(TEXT("ValueUnitImported"), Import(TEXT("ValueUnits"),
+		TEXT("TimerName,Incl\n")
+		TEXT("SBProfiledSubsystem,250 us\n")
+		TEXT("SBProfiledSubsystem,1.5\n"), Results, bHasCallCounts)))
+	{
+		const FSubsystemProfileTiming* Timing = Results.Find(ClassName);
+		if (TestNotNull(TEXT("ValueUnitTiming"), Timing))
+		{
+			TestEqual(TEXT("ValueUnitTotalMs"), Timing->TotalMs, 1.75, Tolerance);
+			TestEqual(TEXT("ValueUnitCalls"), Timing->Calls, (int64)2);
+		}
+	}
+
+	// timing events in seconds: nested scope of same class on same thread is counted once, other thread separately
+	if (TestTrue(TEXT("EventImported"), Import(TEXT("Events"),
+		TEXT("ThreadId,TimerName,StartTime,EndTime,Duration\n")
+		TEXT("1,SBProfiledSubsystem,1.000,1.010,0.010\n")
+		TEXT("1,USBProfiledSubsystem::Tick,1.002,1.004,0.002\n")
+		TEXT("1,SBProfiledSubsystem,1.020,1.021,0.001\n")
+		TEXT("2,SBProfiledSubsystem,1.001,1.003,0.002\n"), Results, bHasCallCounts)))
+	{
+		const FSubsystemProfileTiming* Timing = Results.Find(ClassName);
+		if (TestNotNull(TEXT("EventTiming"), Timing))
+		{
+			TestEqual(TEXT("EventTotalMs"), Timing->TotalMs, 13.0, Tolerance);
+			TestEqual(TEXT("EventCalls"), Timing->Calls, (int64)3);
+		}
+	}
+
+	// timing events without duration use difference of start and end columns in their own units
+	if (TestTrue(TEXT("RangeImported"), Import(TEXT("Ranges"),
+		TEXT("TimerName,StartTime (ms),EndTime [ms]\n")
+		TEXT("SBProfiledSubsystem,10,14\n"), Results, bHasCallCounts)))
+	{
+		const FSubsystemProfileTiming* Timing = Results.Find(ClassName);
+		if (TestNotNull(TEXT("RangeTiming"), Timing))
+		{
+			TestEqual(TEXT("RangeTotalMs"), Timing->TotalMs, 4.0, Tolerance);
+			TestEqual(TEXT("RangeCalls"), Timing->Calls, (int64)1);
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,98 @@
+// Copyright 2022, Aquanox.
+
+#include "SubsystemBrowserStressCategory.h"
+
+#include "HAL/IConsoleManager.h"
+#include "UObject/Package.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+static TAutoConsoleVariable<int32> CVarStressNumObjects(
+	TEXT("SubsystemBrowser.Stress.NumObjects"), 0,
+	TEXT("Number of synthetic objects displayed in Stress category (0 - disabled)."));
+
+static TAutoConsoleVariable<int32> CVarStressNumSubobjects(
+	TEXT("SubsystemBrowser.Stress.NumSubobjects"), 0,
+	TEXT("Number of subobjects each synthetic object exposes via SBGetSubobjects."));
+
+static TAutoConsoleVariable<int32> CVarStressPayloadSize(
+	TEXT("SubsystemBrowser.Stress.PayloadSize"), 0,
+	TEXT("Number of struct entries in payload array property of each synthetic object."));
+
+static TAutoConsoleVariable<bool> CVarStressWithMetadata(
+	TEXT("SubsystemBrowser.Stress.WithMetadata"), false,
+	TEXT("Use synthetic object class with SBTooltip, SBColor and SBOwnerName metadata."));
+
+FString USBStressMetaObject::GetSBOwnerName() const
+{
+	return GetName();
+}
+
+FSubsystemStressParams FSubsystemStressParams::FromConsoleVariables()
+{
+	FSubsystemStressParams Result;
+	Result.NumObjects = FMath::Max(0, CVarStressNumObjects.GetValueOnGameThread());
+	Result.NumSubobjects = FMath::Max(0, CVarStressNumSubobjects.GetValueOnGameThread());
+	Result.PayloadSize = FMath::Max(0, CVarStressPayloadSize.GetValueOnGameThread());
+	Result.bWithMetadata = CVarStressWithMetadata.GetValueOnGameThread();
+	return Result;
+}
+
+const FName FSubsystemCategory_Stress::DefaultName = TEXT("StressCategory");
+
+FSubsystemCategory_Stress::FSubsystemCategory_Stress()
+	: FSubsystemCategory(DefaultName, INVTEXT("Stress Test"), 10000)
+{
+}
+
+FSubsystemCategory_Stress::FSubsystemCategory_Stress(FName InName, const FSubsystemStressParams& InParams)
+	: FSubsystemCategory(InName, INVTEXT("Stress Test"), 10000)
+	, bUseConsoleVariables(false)
+{
+	GenerateObjects(InParams);
+}
+
+void FSubsystemCategory_Stress::Select(UWorld* InContext, TArray<UObject*>& OutData) const
+{
+	for (const TStrongObjectPtr<USBStressObject>& Object : GetObjects())
+	{
+		OutData.Add(Object.Get());
+	}
+}
+
+const TArray<TStrongObjectPtr<USBStressObject>>& FSubsystemCategory_Stress::GetObjects() const
+{
+	if (bUseConsoleVariables)
+	{
+		const FSubsystemStressParams NewParams = FSubsystemStressParams::FromConsoleVariables();
+		if (NewParams != Params)
+		{
+			GenerateObjects(NewParams);
+		}
+	}
+	return Objects;
+}
+
+void FSubsystemCategory_Stress::GenerateObjects(const FSubsystemStressParams& InParams) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSubsystemCategory_Stress::GenerateObjects);
+
+	Params = InParams;
+	Objects.Empty(InParams.NumObjects);
+
+	UClass* const ObjectClass = InParams.bWithMetadata ? USBStressMetaObject::StaticClass() : USBStressObject::StaticClass();
+
+	for (int32 Idx = 0; Idx < InParams.NumObjects; ++Idx)
+	{
+		USBStressObject* Object = NewObject<USBStressObject>(GetTransientPackage(), ObjectClass, NAME_None, RF_Transient);
+		Object->ConfigIntProperty = Idx;
+		Object->Payload.SetNum(InParams.PayloadSize);
+
+		Object->Subobjects.Reserve(InParams.NumSubobjects);
+		for (int32 SubIdx = 0; SubIdx < InParams.NumSubobjects; ++SubIdx)
+		{
+			Object->Subobjects.Add(NewObject<USBStressSubobject>(Object, NAME_None, RF_Transient));
+		}
+
+		Objects.Emplace(Object);
+	}
+}
@@ -0,0 +1,119 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "CoreFwd.h"
+#include "UObject/Object.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Model/SubsystemBrowserCategory.h"
+#include "SubsystemBrowserTestSubsystem.h"
+#include "SubsystemBrowserStressCategory.generated.h"
+
+/**
+ * Subobject of synthetic stress object, displayed via SBGetSubobjects
+ */
+UCLASS(Transient, meta=(SBSubobject))
+class SUBSYSTEMBROWSERTESTS_API USBStressSubobject : public UObject
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(EditAnywhere, Category="Stress")
+	int32 Foo = 0;
+	UPROPERTY(EditAnywhere, Category="Stress")
+	FSBDemoStruct Structz;
+};
+
+/**
+ * Synthetic object that stands in for a subsystem in stress category
+ */
+UCLASS(Transient, Config=Test, meta=(SBGetSubobjects="auto"))
+class SUBSYSTEMBROWSERTESTS_API USBStressObject : public UObject
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(Config, EditAnywhere, Category="Stress")
+	int32 ConfigIntProperty = 0;
+	UPROPERTY(Config, EditAnywhere, Category="Stress")
+	FString ConfigStringProperty;
+	UPROPERTY(Config, EditAnywhere, Category="Stress")
+	TArray<FSBDemoStruct> ConfigArrayOfStructsProperty;
+	UPROPERTY(EditAnywhere, Category="Stress")
+	FSBDemoStruct Structz;
+
+	/* Payload entries, number controlled by SubsystemBrowser.Stress.PayloadSize */
+	UPROPERTY(EditAnywhere, Category="Stress")
+	TArray<FSBDemoStruct> Payload;
+
+	UPROPERTY()
+	TArray<USBStressSubobject*> Subobjects;
+};
+
+/**
+ * Synthetic stress object that has all supported class metadata specified
+ */
+UCLASS(Transient, Config=Test,
+	meta=(SBTooltip="Stress object with metadata", SBColor="(R=0,G=128,B=255)", SBOwnerName="GetSBOwnerName"))
+class SUBSYSTEMBROWSERTESTS_API USBStressMetaObject : public USBStressObject
+{
+	GENERATED_BODY()
+public:
+	UFUNCTION()
+	FString GetSBOwnerName() const;
+};
+
+/**
+ * Parameters of synthetic data produced by stress category
+ */
+struct FSubsystemStressParams
+{
+	/* number of objects to display */
+	int32 NumObjects = 0;
+	/* number of subobjects per object */
+	int32 NumSubobjects = 0;
+	/* number of payload entries per object */
+	int32 PayloadSize = 0;
+	/* use class with metadata */
+	bool bWithMetadata = false;
+
+	/* Read parameters from SubsystemBrowser.Stress.* console variables */
+	static FSubsystemStressParams FromConsoleVariables();
+
+	bool operator==(const FSubsystemStressParams& Other) const
+	{
+		return NumObjects == Other.NumObjects && NumSubobjects == Other.NumSubobjects
+			&& PayloadSize == Other.PayloadSize && bWithMetadata == Other.bWithMetadata;
+	}
+	bool operator!=(const FSubsystemStressParams& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Optional category that displays a configurable number of synthetic objects.
+ *
+ * By default parameters are taken from SubsystemBrowser.Stress.* console variables,
+ * objects are regenerated on next Select when any of them changes.
+ */
+struct SUBSYSTEMBROWSERTESTS_API FSubsystemCategory_Stress : public FSubsystemCategory
+{
+	static const FName DefaultName;
+
+	/* Construct category driven by console variables */
+	FSubsystemCategory_Stress();
+	/* Construct category with fixed parameters */
+	FSubsystemCategory_Stress(FName InName, const FSubsystemStressParams& InParams);
+
+	virtual bool IsVisibleByDefaultInBrowser() const override { return false; }
+	virtual bool IsVisibleInSettings() const override { return false; }
+	virtual void Select(UWorld* InContext, TArray<UObject*>& OutData) const override;
+	virtual void SelectSettings(TArray<UObject*>& OutData) const override { }
+
+	/* Get currently generated objects, regenerating them if parameters changed */
+	const TArray<TStrongObjectPtr<USBStressObject>>& GetObjects() const;
+
+private:
+	void GenerateObjects(const FSubsystemStressParams& InParams) const;
+
+	bool bUseConsoleVariables = true;
+
+	mutable FSubsystemStressParams Params;
+	mutable TArray<TStrongObjectPtr<USBStressObject>> Objects;
+};
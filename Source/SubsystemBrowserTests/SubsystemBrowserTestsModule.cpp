@@ -2,18 +2,25 @@
 
 #include "SubsystemBrowserTestsModule.h"
 
+#include "SubsystemBrowserModule.h"
+#include "SubsystemBrowserStressCategory.h"
+
 #define LOCTEXT_NAMESPACE "FSubsystemBrowserTestsModule"
 
 void FSubsystemBrowserTestsModule::StartupModule()
 {
-
+	FSubsystemBrowserModule& BrowserModule = FModuleManager::LoadModuleChecked<FSubsystemBrowserModule>(TEXT("SubsystemBrowser"));
+	BrowserModule.RegisterCategory<FSubsystemCategory_Stress>();
 }
 
 void FSubsystemBrowserTestsModule::ShutdownModule()
 {
-
+	if (FSubsystemBrowserModule* BrowserModule = FModuleManager::GetModulePtr<FSubsystemBrowserModule>(TEXT("SubsystemBrowser")))
+	{
+		BrowserModule->RemoveCategory(FSubsystemCategory_Stress::DefaultName);
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
 
-IMPLEMENT_MODULE(FDefaultModuleImpl, SubsystemBrowserTests)
\ No newline at end of file
+IMPLEMENT_MODULE(FSubsystemBrowserTestsModule, SubsystemBrowserTests)
\ No newline at end of file
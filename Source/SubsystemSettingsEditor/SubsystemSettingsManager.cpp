@@ -5,6 +5,8 @@
 #include "SubsystemBrowserModule.h"
 #include "SubsystemBrowserSettings.h"
 #include "SubsystemBrowserStyle.h"
+#include "SubsystemBrowserTrace.h"
+#include "Model/SubsystemBrowserPerfStats.h"
 #include "ISettingsModule.h"
 #include "ISettingsSection.h"
 #include "ISettingsContainer.h"
@@ -20,6 +22,7 @@
 #include "UObject/UObjectIterator.h"
 #include "UI/SubsystemBrowserPanel.h"
 #include "UI/SubsystemSettingsWidget.h"
+#include "UI/SubsystemSettingsPlaceholder.h"
 #include "UI/SubsystemDetailsCustomizations.h"
 #include "SubsystemSettingsEditorModule.h"
 
@@ -90,6 +93,8 @@ void FSubsystemSettingsManager::Unregister()
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SubsystemSettingsTabName);
 
 	FModuleManager::Get().OnModulesChanged().RemoveAll(this);
+
+	FTickerHelper::RemoveTicker(DeferredUpdateHandle);
 }
 
 void FSubsystemSettingsManager::ShowSettings(const FName& CategoryName, const FName& SectionName)
@@ -174,13 +179,35 @@ TSharedRef<SDockTab> FSubsystemSettingsManager::HandleSpawnSettingsTab(const FSp
 void FSubsystemSettingsManager::HandleCategoriesChanged()
 {
 	bNeedsRediscover = true;
-	UpdateDiscoveredSubsystems();
+	RequestDeferredUpdate();
 }
 
 void FSubsystemSettingsManager::HandleModulesChanges(FName Name, EModuleChangeReason ModuleChangeReason)
 {
+	if (ModuleChangeReason == EModuleChangeReason::PluginDirectoryChanged)
+		return;
+
+	// Module loads come in bursts (editor startup, live coding), process them all at once
 	bNeedsRediscover = true;
+	RequestDeferredUpdate();
+}
+
+void FSubsystemSettingsManager::RequestDeferredUpdate()
+{
+	if (!DeferredUpdateHandle.IsValid())
+	{
+		DeferredUpdateHandle = FTickerHelper::AddTicker(FTickerDelegate::CreateRaw(this, &FSubsystemSettingsManager::HandleDeferredUpdate));
+	}
+}
+
+bool FSubsystemSettingsManager::HandleDeferredUpdate(float DeltaTime)
+{
+	DeferredUpdateHandle.Reset();
+
 	UpdateDiscoveredSubsystems();
+
+	// single-shot
+	return false;
 }
 
 void FSubsystemSettingsManager::UpdateDiscoveredSubsystems(bool bForce)
@@ -189,16 +216,29 @@ void FSubsystemSettingsManager::UpdateDiscoveredSubsystems(bool bForce)
 
 	if ((TrackedSettingsWidget.IsValid() || bForce) && bNeedsRediscover)
 	{
+		SB_TRACE_SCOPE(FSubsystemSettingsManager::UpdateDiscoveredSubsystems);
+
 		bNeedsRediscover = false;
 
-		UnregisterDiscoveredSubsystems(SettingsModule);
+		if (bNeedsFullRediscover)
+		{
+			bNeedsFullRediscover = false;
+			UnregisterDiscoveredSubsystems(SettingsModule);
+		}
+
 		RegisterDiscoveredSubsystems(SettingsModule);
 	}
 }
 
-void FSubsystemSettingsManager::RegisterDiscoveredSubsystems(ISettingsModule& SettingsModule)
+void FSubsystemSettingsManager::CollectDiscoverableSubsystems(TArray<FDiscoveredSubsystemInfo>& OutSubsystems) const
 {
-	TArray<UObject*> AllKnownSubsystems;
+	SB_TRACE_STAT_SCOPE(FSubsystemSettingsManager::CollectDiscoverableSubsystems, STAT_SubsystemBrowser_SettingsDiscovery);
+	FSubsystemPerfStats::FScope PerfScope(FSubsystemPerfStats::GetShared(), ESubsystemPerfMetric::SettingsDiscovery);
+
+	TSet<UObject*> AllKnownSubsystems;
+
+	// custom mode allows showing props without Edit specifier, if there's none - ignore object
+	const bool bUseCustom = USubsystemBrowserSettings::Get()->ShouldUseCustomSettingsWidget();
 
 	const TArray<SubsystemCategoryPtr>& RegisteredCategories = FSubsystemBrowserModule::Get().GetCategories();
 	for (const SubsystemCategoryPtr& Ptr : RegisteredCategories)
@@ -209,6 +249,8 @@ void FSubsystemSettingsManager::RegisterDiscoveredSubsystems(ISettingsModule& Se
 		TArray<UObject*> ObjectArray;
 		Ptr->SelectSettings(ObjectArray);
 
+		AllKnownSubsystems.Reserve(AllKnownSubsystems.Num() + ObjectArray.Num());
+
 		for (UObject* Subsystem : ObjectArray)
 		{
 			UClass* SSClass = Subsystem->GetClass();
@@ -228,8 +270,6 @@ void FSubsystemSettingsManager::RegisterDiscoveredSubsystems(ISettingsModule& Se
 				if (!ClassFieldStats.NumConfig)
 					continue;
 
-				// custom mode allows showing props without Edit specifier, if there's none - ignore object
-				bool bUseCustom = USubsystemBrowserSettings::Get()->ShouldUseCustomSettingsWidget();
 				if (!bUseCustom && !ClassFieldStats.NumConfigWithEdit)
 					continue;
 
@@ -239,12 +279,78 @@ void FSubsystemSettingsManager::RegisterDiscoveredSubsystems(ISettingsModule& Se
 					*CategoryName.ToString(), *GetNameSafe(Subsystem), *GetNameSafe(SSClass),
 					ClassFieldStats.NumConfigWithEdit, ClassFieldStats.NumConfig, (int32)bUseCustom);
 
-				RegisterSubsystemSettings(SettingsModule, CategoryName, Subsystem, bUseCustom);
+				FDiscoveredSubsystemInfo& Info = OutSubsystems.AddDefaulted_GetRef();
+				Info.ContainerName = TEXT("Subsystem");
+				Info.CategoryName = CategoryName;
+				Info.SectionName = SSClass->GetFName();
+				Info.Subsystem = Subsystem;
+				Info.bCustomUI = bUseCustom;
 
 				AllKnownSubsystems.Add(Subsystem);
 			}
 		}
 	}
+
+	PerfScope.SetNumItems(OutSubsystems.Num());
+}
+
+void FSubsystemSettingsManager::RegisterDiscoveredSubsystems(ISettingsModule& SettingsModule)
+{
+	SB_TRACE_SCOPE(FSubsystemSettingsManager::RegisterDiscoveredSubsystems);
+
+	TArray<FDiscoveredSubsystemInfo> Discovered;
+	CollectDiscoverableSubsystems(Discovered);
+
+	auto IsSameSection = [](const FDiscoveredSubsystemInfo& A, const FDiscoveredSubsystemInfo& B)
+	{
+		return A.Subsystem == B.Subsystem
+			&& A.CategoryName == B.CategoryName
+			&& A.SectionName == B.SectionName
+			&& A.bCustomUI == B.bCustomUI;
+	};
+
+	TMap<UObject*, int32> DiscoveredIndex;
+	DiscoveredIndex.Reserve(Discovered.Num());
+	for (int32 Index = 0; Index < Discovered.Num(); ++Index)
+	{
+		DiscoveredIndex.Add(Discovered[Index].Subsystem.Get(), Index);
+	}
+
+	// Remove sections that are no longer present (module unloaded, category removed)
+	TBitArray<> AlreadyRegistered(false, Discovered.Num());
+	int32 NumRemoved = 0;
+	for (int32 Index = DiscoveredSettings.Num() - 1; Index >= 0; --Index)
+	{
+		const FDiscoveredSubsystemInfo& Existing = DiscoveredSettings[Index];
+
+		const int32* FoundIndex = DiscoveredIndex.Find(Existing.Subsystem.Get());
+		if (FoundIndex && IsSameSection(Discovered[*FoundIndex], Existing))
+		{
+			AlreadyRegistered[*FoundIndex] = true;
+		}
+		else
+		{
+			SettingsModule.UnregisterSettings(Existing.ContainerName, Existing.CategoryName, Existing.SectionName);
+			RecentSettingsWidgets.Remove(Existing.EditorWidget);
+			DiscoveredSettings.RemoveAt(Index);
+			++NumRemoved;
+		}
+	}
+
+	// Register newly discovered sections (module loaded, category added)
+	int32 NumAdded = 0;
+	for (int32 Index = 0; Index < Discovered.Num(); ++Index)
+	{
+		if (!AlreadyRegistered[Index])
+		{
+			const FDiscoveredSubsystemInfo& Info = Discovered[Index];
+			RegisterSubsystemSettings(SettingsModule, Info.CategoryName, Info.Subsystem.Get(), Info.bCustomUI);
+			++NumAdded;
+		}
+	}
+
+	UE_LOG(LogSubsystemSettingsEditor, Verbose, TEXT("Updated discovered settings: %d added, %d removed, %d total"),
+		NumAdded, NumRemoved, DiscoveredSettings.Num());
 }
 
 void FSubsystemSettingsManager::RegisterSubsystemSettings(ISettingsModule& SettingsModule, FName Category, UObject* Subsystem, bool bCustomUI)
@@ -255,6 +361,8 @@ void FSubsystemSettingsManager::RegisterSubsystemSettings(ISettingsModule& Setti
 	Registered.ContainerName = TEXT("Subsystem");
 	Registered.CategoryName = Category;
 	Registered.SectionName = Class->GetFName();
+	Registered.Subsystem = Subsystem;
+	Registered.bCustomUI = bCustomUI;
 
 	TOptional<FString> OptionalSection = FSubsystemBrowserUtils::GetMetadataOptional(Class, FSubsystemSettingsUserMeta::MD_SBSection);
 	FText DisplayName = OptionalSection.IsSet() ? FText::FromString(OptionalSection.GetValue()) : Class->GetDisplayNameText();
@@ -264,18 +372,25 @@ void FSubsystemSettingsManager::RegisterSubsystemSettings(ISettingsModule& Setti
 
 	if (bCustomUI)
 	{
-		// custom widget for engine subsystems that did not expose any properties for editing
-		Registered.EditorWidget =  SNew(SSubsystemSettingsWidget, Subsystem)
+		// custom widget for engine subsystems that did not expose any properties for editing.
+		// actual widget is constructed once section is viewed
+		Registered.EditorWidget = SNew(SSubsystemSettingsPlaceholder, Subsystem)
 				.CategoryName(Registered.CategoryName)
 				.SectionName(Registered.SectionName)
 				.SectionDisplayName(DisplayName)
-				.SectionTooltipText(DisplayTooltip);
+				.SectionTooltipText(DisplayTooltip)
+				.OnContentRequested(FSimpleDelegate::CreateRaw(this, &FSubsystemSettingsManager::HandleSectionSelected, Registered.CategoryName, Registered.SectionName));
 
-		SettingsModule.RegisterSettings(Registered.ContainerName, Registered.CategoryName, Registered.SectionName,
+		ISettingsSectionPtr Section = SettingsModule.RegisterSettings(Registered.ContainerName, Registered.CategoryName, Registered.SectionName,
             DisplayName,
             DisplayTooltip,
 			Registered.EditorWidget.ToSharedRef()
 		);
+
+		if (Section.IsValid())
+		{
+			Section->OnSelect().BindRaw(this, &FSubsystemSettingsManager::HandleSectionSelected, Registered.CategoryName, Registered.SectionName);
+		}
 	}
 	else
 	{
@@ -297,6 +412,44 @@ void FSubsystemSettingsManager::UnregisterDiscoveredSubsystems(ISettingsModule&
 	}
 
 	DiscoveredSettings.Reset();
+	RecentSettingsWidgets.Reset();
+}
+
+void FSubsystemSettingsManager::HandleSectionSelected(FName CategoryName, FName SectionName)
+{
+	const FDiscoveredSubsystemInfo* Info = DiscoveredSettings.FindByPredicate([&](const FDiscoveredSubsystemInfo& Entry)
+	{
+		return Entry.CategoryName == CategoryName && Entry.SectionName == SectionName;
+	});
+
+	if (!Info || !Info->EditorWidget.IsValid())
+	{
+		return;
+	}
+
+	TSharedRef<SSubsystemSettingsPlaceholder> Widget = Info->EditorWidget.ToSharedRef();
+	FSubsystemBrowserTrace::RecordCacheAccess(FSubsystemBrowserTrace::ECache::SettingsWidget, Widget->HasContent());
+	Widget->CreateContent();
+
+	// Move to the most recently viewed position
+	RecentSettingsWidgets.Remove(Widget);
+	RecentSettingsWidgets.Add(Widget);
+
+	ReleaseSettingsWidgets(USubsystemBrowserSettings::Get()->GetMaxCachedSettingsWidgets());
+}
+
+void FSubsystemSettingsManager::ReleaseSettingsWidgets(int32 NumToKeep)
+{
+	while (RecentSettingsWidgets.Num() > NumToKeep)
+	{
+		TSharedPtr<SSubsystemSettingsPlaceholder> Widget = RecentSettingsWidgets[0].Pin();
+		RecentSettingsWidgets.RemoveAt(0);
+
+		if (Widget.IsValid())
+		{
+			Widget->ReleaseContent();
+		}
+	}
 }
 
 void FSubsystemSettingsManager::HandleSettingsChanged(FName InPropertyName)
@@ -305,7 +458,9 @@ void FSubsystemSettingsManager::HandleSettingsChanged(FName InPropertyName)
 	{
 		if (Property->HasMetaData(FSubsystemBrowserConfigMeta::MD_ConfigAffectsSettings))
 		{
+			// registration mode may change so every section must be registered again
 			bNeedsRediscover = true;
+			bNeedsFullRediscover = true;
 			UpdateDiscoveredSubsystems();
 		}
 	}
@@ -6,11 +6,12 @@
 #include "ISettingsViewer.h"
 #include "Layout/Visibility.h"
 #include "Modules/ModuleManager.h"
+#include "SubsystemBrowserTicker.h"
 
 class SWidget;
 class SDockTab;
 class FSpawnTabArgs;
-class SSubsystemSettingsWidget;
+class SSubsystemSettingsPlaceholder;
 class ISettingsEditorModel;
 class ISettingsSection;
 
@@ -31,7 +32,10 @@ struct FDiscoveredSubsystemInfo
 	FName CategoryName;
 	FName SectionName;
 
-	TSharedPtr<SSubsystemSettingsWidget> EditorWidget;
+	TWeakObjectPtr<UObject> Subsystem;
+	bool bCustomUI = false;
+
+	TSharedPtr<SSubsystemSettingsPlaceholder> EditorWidget;
 };
 
 /**
@@ -68,12 +72,20 @@ public:
 	void HandleSettingsChanged(FName Name);
 
 	void UpdateDiscoveredSubsystems(bool bForce = false);
+	/** Schedule single discovery update for a burst of changes */
+	void RequestDeferredUpdate();
+	bool HandleDeferredUpdate(float DeltaTime);
 
+	void CollectDiscoverableSubsystems(TArray<FDiscoveredSubsystemInfo>& OutSubsystems) const;
 	void RegisterDiscoveredSubsystems(ISettingsModule& SettingsModule);
 	void RegisterSubsystemSettings(ISettingsModule& SettingsModule, FName Category, UObject* Subsystem, bool bCustomUI);
 
 	void UnregisterDiscoveredSubsystems(ISettingsModule& SettingsModule);
 
+	/** Construct settings widget for viewed section and release least recently viewed ones */
+	void HandleSectionSelected(FName CategoryName, FName SectionName);
+	void ReleaseSettingsWidgets(int32 NumToKeep);
+
 	TWeakPtr<ISettingsEditorModel> GetSettingsEditorModel() const { return SettingsEditorModelPtr; }
 	TWeakPtr<SWidget> GetSettingsEditorWidget() const { return SettingsEditorPtr; }
 
@@ -91,6 +103,14 @@ private:
 	// Tracked list of discovered settings
 	TArray<FDiscoveredSubsystemInfo> DiscoveredSettings;
 
+	// Sections with constructed settings widgets, from least to most recently viewed
+	TArray<TWeakPtr<SSubsystemSettingsPlaceholder>> RecentSettingsWidgets;
+
 	// Flag to indicate settings need to be rediscovered upon next panel opening
 	bool bNeedsRediscover = true;
+	// Flag to indicate all discovered settings must be registered again (registration mode changed)
+	bool bNeedsFullRediscover = false;
+
+	// Pending coalesced discovery update
+	FTickerHelper::FHandle DeferredUpdateHandle;
 };
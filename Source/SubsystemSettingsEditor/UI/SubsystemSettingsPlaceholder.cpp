@@ -0,0 +1,81 @@
+// Copyright 2022, Aquanox.
+
+#include "UI/SubsystemSettingsPlaceholder.h"
+
+#include "UI/SubsystemSettingsWidget.h"
+#include "Widgets/SNullWidget.h"
+#include "SubsystemSettingsEditorModule.h"
+#include "SubsystemBrowserTrace.h"
+
+void SSubsystemSettingsPlaceholder::Construct(const FArguments& InArgs, UObject* InObject)
+{
+	TargetObject = InObject;
+
+	CategoryName = InArgs._CategoryName;
+	SectionName = InArgs._SectionName;
+	SectionDisplayName = InArgs._SectionDisplayName;
+	SectionTooltipText = InArgs._SectionTooltipText;
+
+	OnContentRequested = InArgs._OnContentRequested;
+
+	ChildSlot
+	[
+		SNullWidget::NullWidget
+	];
+}
+
+void SSubsystemSettingsPlaceholder::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// Section selection normally constructs content before first paint,
+	// this covers cases when widget is shown without going through selection
+	if (!Content.IsValid() && !bContentRequested)
+	{
+		bContentRequested = true;
+		OnContentRequested.ExecuteIfBound();
+	}
+}
+
+void SSubsystemSettingsPlaceholder::CreateContent()
+{
+	if (Content.IsValid() || !TargetObject.IsValid())
+	{
+		return;
+	}
+
+	SB_TRACE_SCOPE(SSubsystemSettingsPlaceholder::CreateContent);
+
+	UE_LOG(LogSubsystemSettingsEditor, Verbose, TEXT("Creating settings widget for %s:%s"), *CategoryName.ToString(), *SectionName.ToString());
+
+	Content = SNew(SSubsystemSettingsWidget, TargetObject.Get())
+		.CategoryName(CategoryName)
+		.SectionName(SectionName)
+		.SectionDisplayName(SectionDisplayName)
+		.SectionTooltipText(SectionTooltipText);
+
+	ChildSlot
+	[
+		Content.ToSharedRef()
+	];
+
+	bContentRequested = false;
+}
+
+void SSubsystemSettingsPlaceholder::ReleaseContent()
+{
+	if (!Content.IsValid())
+	{
+		return;
+	}
+
+	UE_LOG(LogSubsystemSettingsEditor, Verbose, TEXT("Releasing settings widget for %s:%s"), *CategoryName.ToString(), *SectionName.ToString());
+
+	ChildSlot
+	[
+		SNullWidget::NullWidget
+	];
+
+	Content.Reset();
+	bContentRequested = false;
+}
@@ -0,0 +1,53 @@
+// Copyright 2022, Aquanox.
+
+#pragma once
+
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/SCompoundWidget.h"
+
+class SSubsystemSettingsWidget;
+
+/**
+ * Lightweight stand-in for SSubsystemSettingsWidget registered within settings module.
+ *
+ * Actual settings widget (and its details view) is constructed only when section is viewed
+ * and can be released by settings manager to keep number of live details views bounded.
+ */
+class SSubsystemSettingsPlaceholder : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SSubsystemSettingsPlaceholder)
+		{ }
+		SLATE_ARGUMENT(FName, CategoryName)
+		SLATE_ARGUMENT(FName, SectionName)
+		SLATE_ARGUMENT(FText, SectionDisplayName)
+		SLATE_ARGUMENT(FText, SectionTooltipText)
+		/** Called when placeholder is displayed without content */
+		SLATE_EVENT(FSimpleDelegate, OnContentRequested)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, UObject* InObject);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+	/** Is actual settings widget constructed */
+	bool HasContent() const { return Content.IsValid(); }
+	/** Construct actual settings widget if it does not exist */
+	void CreateContent();
+	/** Release actual settings widget */
+	void ReleaseContent();
+
+private:
+	TWeakObjectPtr<UObject> TargetObject;
+
+	FName CategoryName;
+	FName SectionName;
+	FText SectionDisplayName;
+	FText SectionTooltipText;
+
+	FSimpleDelegate OnContentRequested;
+	/* content was requested and not created yet, request is made once until content is set or released */
+	bool bContentRequested = false;
+
+	TSharedPtr<SSubsystemSettingsWidget> Content;
+};